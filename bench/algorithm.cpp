@@ -0,0 +1,132 @@
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+#include "bench.hpp"
+#include "fixed_vector_algorithm.hpp"
+
+namespace {
+constexpr std::size_t compact_size = 4096;
+using compact_vec_t = kt::fixed_vector<std::int32_t, compact_size>;
+
+constexpr std::size_t set_size = std::size_t{1} << 16;
+using set_vec_t = kt::fixed_vector<std::uint32_t, set_size>;
+
+// Sorted distinct values drawn from [0, 4 * set_size)
+std::unique_ptr<set_vec_t> make_set(kt::bench::rng& rng, std::size_t count) {
+	std::vector<std::uint32_t> values;
+	while (values.size() < count) {
+		for (std::size_t i = values.size(); i < count; ++i) { values.push_back(rng.below(4 * set_size)); }
+		std::sort(values.begin(), values.end());
+		values.erase(std::unique(values.begin(), values.end()), values.end());
+	}
+	auto ret = std::make_unique<set_vec_t>();
+	ret->insert(ret->end(), values.begin(), values.end());
+	return ret;
+}
+
+constexpr std::size_t partition_input = std::size_t{1} << 20;
+
+template <std::size_t K>
+bool partition_k(std::vector<std::uint32_t> const& src) {
+	// twice the mean partition size, so the uniform input never overflows
+	constexpr std::size_t capacity = 2 * partition_input / K;
+	struct parts_t {
+		kt::fixed_vector<std::uint32_t, capacity> parts[K];
+	};
+	auto const staged = std::make_unique<parts_t>();
+	auto const direct = std::make_unique<parts_t>();
+	int shift = 32;
+	for (std::size_t k = K; k > 1; k >>= 1) { --shift; }
+	auto const key_fn = [shift](std::uint32_t t) { return static_cast<std::size_t>(static_cast<std::uint64_t>(t) >> shift); };
+	std::string const suffix = " K=" + std::to_string(K);
+	kt::bench::report("partition_into", ("push_back per element" + suffix).c_str(), kt::bench::ns_per_op(src.size(), [&] {
+		for (auto& part : direct->parts) { part.clear(); }
+		for (std::uint32_t const t : src) { direct->parts[key_fn(t)].push_back(t); }
+		kt::bench::do_not_optimize(direct->parts[0].size());
+	}));
+	bool overflow = false;
+	kt::bench::report("partition_into", ("partition_into" + suffix).c_str(), kt::bench::ns_per_op(src.size(), [&] {
+		for (auto& part : staged->parts) { part.clear(); }
+		overflow = kt::partition_into(src.begin(), src.end(), key_fn, staged->parts).any() || overflow;
+		kt::bench::do_not_optimize(staged->parts[0].size());
+	}));
+	bool ok = !overflow;
+	for (std::size_t k = 0; k < K; ++k) { ok = ok && staged->parts[k] == direct->parts[k]; }
+	return ok;
+}
+} // namespace
+
+// Stream compaction of 4k random int32 at 10 / 50 / 90% selectivity: branchy loop, branchless push_back_if, and the comparison overload
+KT_BENCH(compact) {
+	kt::bench::rng rng;
+	compact_vec_t src;
+	for (std::size_t i = 0; i < compact_size; ++i) { src.push_back(static_cast<std::int32_t>(rng.below(1000))); }
+	bool ok = true;
+	for (std::int32_t const percent : {10, 50, 90}) {
+		std::int32_t const bound = percent * 10;
+		compact_vec_t branchy;
+		compact_vec_t branchless;
+		compact_vec_t kernel;
+		auto const pred = [bound](std::int32_t t) { return t < bound; };
+		std::string const suffix = " " + std::to_string(percent) + "%";
+		kt::bench::report("compact", ("branchy push_back" + suffix).c_str(), kt::bench::ns_per_op(compact_size, [&] {
+			branchy.clear();
+			for (std::int32_t const t : src) {
+				if (pred(t)) { branchy.push_back(t); }
+			}
+			kt::bench::do_not_optimize(branchy.size());
+		}));
+		kt::bench::report("compact", ("compact_into(pred)" + suffix).c_str(), kt::bench::ns_per_op(compact_size, [&] {
+			branchless.clear();
+			kt::compact_into(src.begin(), src.end(), branchless, pred);
+			kt::bench::do_not_optimize(branchless.size());
+		}));
+		kt::bench::report("compact", ("compact_into(std::less, bound)" + suffix).c_str(), kt::bench::ns_per_op(compact_size, [&] {
+			kernel.clear();
+			kt::compact_into(src, kernel, std::less<>{}, bound);
+			kt::bench::do_not_optimize(kernel.size());
+		}));
+		ok = ok && branchy == branchless && branchy == kernel;
+	}
+	return ok;
+}
+
+// set_intersection against std::set_intersection: a 64k set intersected with sets from equal size (merge) down to 1/1024 (galloping)
+KT_BENCH(set_intersection) {
+	kt::bench::rng rng;
+	auto const large = make_set(rng, set_size);
+	auto out = std::make_unique<set_vec_t>();
+	std::vector<std::uint32_t> std_out;
+	std_out.reserve(set_size);
+	bool ok = true;
+	for (std::size_t const small_size : {set_size, set_size / 16, set_size / 64, set_size / 1024}) {
+		auto const small = make_set(rng, small_size);
+		std::string const suffix = " " + std::to_string(small_size) + " x " + std::to_string(set_size);
+		kt::bench::report("set_intersection", ("std::set_intersection" + suffix).c_str(), kt::bench::ns_per_op(1, [&] {
+			std_out.clear();
+			std::set_intersection(small->data(), small->data() + small->size(), large->data(), large->data() + large->size(), std::back_inserter(std_out));
+			kt::bench::do_not_optimize(std_out.size());
+		}));
+		kt::bench::report("set_intersection", ("kt::set_intersection" + suffix).c_str(), kt::bench::ns_per_op(1, [&] {
+			out->clear();
+			kt::set_intersection(*small, *large, *out);
+			kt::bench::do_not_optimize(out->size());
+		}));
+		ok = ok && std::equal(out->data(), out->data() + out->size(), std_out.begin(), std_out.end());
+	}
+	return ok;
+}
+
+// partition_into (cache-line staging per partition) against a push_back per element, sweeping K over 1M random uint32 keyed by their top bits
+KT_BENCH(partition_into) {
+	kt::bench::rng rng;
+	std::vector<std::uint32_t> src(partition_input);
+	for (std::uint32_t& t : src) { t = static_cast<std::uint32_t>(rng() >> 32); }
+	bool ok = partition_k<4>(src);
+	ok = partition_k<16>(src) && ok;
+	ok = partition_k<64>(src) && ok;
+	ok = partition_k<256>(src) && ok;
+	ok = partition_k<1024>(src) && ok;
+	return ok;
+}
@@ -0,0 +1,84 @@
+// KT benchmarks
+// Requirements: C++17
+
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+namespace kt::bench {
+///
+/// \brief A registered benchmark; returns false if a built-in check failed
+///
+struct entry {
+	char const* name;
+	bool (*run)();
+};
+
+inline std::vector<entry>& registry() {
+	static std::vector<entry> ret;
+	return ret;
+}
+struct registrar {
+	registrar(char const* name, bool (*run)()) { registry().push_back({name, run}); }
+};
+
+///
+/// \brief Keep value (and everything it depends on) from being optimized away
+///
+template <typename T>
+void do_not_optimize(T const& value) {
+#if defined(__GNUC__) || defined(__clang__)
+	asm volatile("" : : "r,m"(value) : "memory");
+#else
+	static_cast<void>(*static_cast<T const volatile*>(&value));
+#endif
+}
+
+///
+/// \brief Best-of-5 wall time of f() in nanoseconds per op, where one call of f performs ops operations
+/// Each sample repeats f until at least 20ms have elapsed
+///
+template <typename F>
+double ns_per_op(std::uint64_t ops, F&& f) {
+	using clock_t = std::chrono::steady_clock;
+	f();
+	double best = 1e300;
+	for (int sample = 0; sample < 5; ++sample) {
+		std::uint64_t calls = 0;
+		auto const start = clock_t::now();
+		auto elapsed = clock_t::duration{};
+		do {
+			f();
+			++calls;
+			elapsed = clock_t::now() - start;
+		} while (elapsed < std::chrono::milliseconds(20));
+		double const ns = std::chrono::duration<double, std::nano>(elapsed).count() / static_cast<double>(calls * ops);
+		best = ns < best ? ns : best;
+	}
+	return best;
+}
+
+inline void report(char const* bench, char const* variant, double ns) { std::printf("%-20s %-48s %10.2f ns/op\n", bench, variant, ns); }
+
+///
+/// \brief Deterministic xorshift64* generator for inputs
+///
+struct rng {
+	std::uint64_t state = 0x9e3779b97f4a7c15ULL;
+
+	std::uint64_t operator()() noexcept {
+		state ^= state >> 12;
+		state ^= state << 25;
+		state ^= state >> 27;
+		return state * 0x2545f4914f6cdd1dULL;
+	}
+	std::uint32_t below(std::uint32_t bound) noexcept { return static_cast<std::uint32_t>(((*this)() >> 32) * bound >> 32); }
+};
+} // namespace kt::bench
+
+#define KT_BENCH(name)                                                                                                                                         \
+	static bool name();                                                                                                                                        \
+	static kt::bench::registrar const name##_registrar(#name, &name);                                                                                          \
+	static bool name()
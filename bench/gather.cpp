@@ -0,0 +1,97 @@
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <vector>
+#include "bench.hpp"
+#include "fixed_vector_algorithm.hpp"
+
+namespace {
+constexpr std::size_t batch_size = 4096;
+// Batches are used round-robin so that repeated calls do not find their entries in cache
+constexpr std::size_t batch_count = 2048;
+
+struct entry_t {
+	std::uint64_t key;
+	std::uint64_t value;
+};
+
+// Table size in MiB, from KT_BENCH_GATHER_MB; the default of 1 GiB is meant to exceed the last-level cache
+std::size_t table_bytes() {
+	char const* env = std::getenv("KT_BENCH_GATHER_MB");
+	std::size_t const mib = env ? std::strtoull(env, nullptr, 10) : 1024;
+	return (mib > 0 ? mib : 1) << 20;
+}
+} // namespace
+
+// gather and for_each_prefetched over random entries of a table larger than the LLC, with and without software prefetch
+KT_BENCH(gather) {
+	std::size_t const count = table_bytes() / sizeof(entry_t);
+	std::unique_ptr<entry_t[]> const table(new entry_t[count]);
+	for (std::size_t i = 0; i < count; ++i) { table[i] = {i, i * 3}; }
+	kt::bench::rng rng;
+	using indices_t = kt::fixed_vector<std::uint32_t, batch_size>;
+	using ptrs_t = kt::fixed_vector<entry_t const*, batch_size>;
+	std::vector<indices_t> indices(batch_count);
+	std::vector<ptrs_t> ptrs(batch_count);
+	std::vector<std::uint64_t> expected(batch_count);
+	for (std::size_t b = 0; b < batch_count; ++b) {
+		for (std::size_t i = 0; i < batch_size; ++i) {
+			auto const index = rng.below(static_cast<std::uint32_t>(count));
+			indices[b].push_back(index);
+			ptrs[b].push_back(&table[index]);
+			expected[b] += table[index].value;
+		}
+	}
+	std::string const size = " " + std::to_string(count * sizeof(entry_t) >> 20) + " MiB";
+	bool ok = true;
+	std::size_t batch = 0;
+	kt::fixed_vector<entry_t, batch_size> out;
+	for (std::size_t const distance : {std::size_t{0}, std::size_t{8}, std::size_t{16}, std::size_t{32}}) {
+		kt::bench::report("gather", ("gather distance " + std::to_string(distance) + size).c_str(), kt::bench::ns_per_op(batch_size, [&] {
+			batch = (batch + 1) % batch_count;
+			out.clear();
+			kt::gather(indices[batch], table.get(), out, distance);
+			kt::bench::do_not_optimize(out.back());
+		}));
+		std::uint64_t sum = 0;
+		for (entry_t const& e : out) { sum += e.value; }
+		ok = ok && sum == expected[batch];
+	}
+	std::uint64_t sum = 0;
+	kt::bench::report("gather", ("pointer loop" + size).c_str(), kt::bench::ns_per_op(batch_size, [&] {
+		batch = (batch + 1) % batch_count;
+		sum = 0;
+		for (entry_t const* e : ptrs[batch]) { sum += e->value; }
+		kt::bench::do_not_optimize(sum);
+	}));
+	ok = ok && sum == expected[batch];
+	for (std::size_t const distance : {std::size_t{8}, std::size_t{16}, std::size_t{32}}) {
+		kt::bench::report("gather", ("for_each_prefetched distance " + std::to_string(distance) + size).c_str(), kt::bench::ns_per_op(batch_size, [&] {
+			batch = (batch + 1) % batch_count;
+			sum = 0;
+			kt::for_each_prefetched(ptrs[batch], [&sum](entry_t const& e) { sum += e.value; }, distance);
+			kt::bench::do_not_optimize(sum);
+		}));
+		ok = ok && sum == expected[batch];
+	}
+	// with enough work per element the out-of-order window no longer covers the misses, and prefetching is what overlaps them
+	auto const work = [](std::uint64_t v) {
+		for (int round = 0; round < 16; ++round) { v = kt::detail::hash_mix(v); }
+		return v;
+	};
+	kt::bench::report("gather", ("pointer loop + work" + size).c_str(), kt::bench::ns_per_op(batch_size, [&] {
+		batch = (batch + 1) % batch_count;
+		sum = 0;
+		for (entry_t const* e : ptrs[batch]) { sum += work(e->value); }
+		kt::bench::do_not_optimize(sum);
+	}));
+	for (std::size_t const distance : {std::size_t{8}, std::size_t{16}}) {
+		kt::bench::report("gather", ("for_each_prefetched + work distance " + std::to_string(distance) + size).c_str(), kt::bench::ns_per_op(batch_size, [&] {
+			batch = (batch + 1) % batch_count;
+			sum = 0;
+			kt::for_each_prefetched(ptrs[batch], [&sum, &work](entry_t const& e) { sum += work(e.value); }, distance);
+			kt::bench::do_not_optimize(sum);
+		}));
+	}
+	return ok;
+}
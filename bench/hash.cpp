@@ -0,0 +1,64 @@
+#include <algorithm>
+#include <string>
+#include <unordered_set>
+#include "bench.hpp"
+#include "fixed_vector.hpp"
+
+namespace {
+using path_t = kt::fixed_vector<std::uint32_t, 8>;
+
+// The element-by-element combine loop std::hash<fixed_vector> replaces
+struct combine_hash {
+	std::size_t operator()(path_t const& key) const noexcept {
+		std::size_t ret = key.size();
+		for (std::uint32_t const c : key) { ret ^= std::hash<std::uint32_t>{}(c) + 0x9e3779b9 + (ret << 6) + (ret >> 2); }
+		return ret;
+	}
+};
+
+// Path-like keys: 1 to 8 components drawn from a small vocabulary, so many keys share prefixes
+std::vector<path_t> make_keys(std::size_t count) {
+	kt::bench::rng rng;
+	std::vector<path_t> ret(count);
+	for (path_t& key : ret) {
+		std::uint32_t const size = 1 + rng.below(8);
+		for (std::uint32_t i = 0; i < size; ++i) { key.push_back(rng.below(1024)); }
+	}
+	std::sort(ret.begin(), ret.end());
+	ret.erase(std::unique(ret.begin(), ret.end()), ret.end());
+	return ret;
+}
+
+template <typename Hash>
+void run(char const* name, std::vector<path_t> const& keys) {
+	std::vector<std::uint64_t> hashes(keys.size());
+	std::vector<std::uint32_t> buckets(std::size_t{1} << 16);
+	for (std::size_t i = 0; i < keys.size(); ++i) {
+		hashes[i] = Hash{}(keys[i]);
+		++buckets[hashes[i] & (buckets.size() - 1)];
+	}
+	std::sort(hashes.begin(), hashes.end());
+	auto const collisions = static_cast<std::size_t>(hashes.end() - std::unique(hashes.begin(), hashes.end()));
+	std::printf("%-20s %-48s %zu full-width collisions over %zu keys, fullest of 65536 low-bit buckets %u (mean %.1f)\n", "hash", name, collisions, keys.size(),
+				*std::max_element(buckets.begin(), buckets.end()), static_cast<double>(keys.size()) / static_cast<double>(buckets.size()));
+
+	kt::bench::report("hash", name, kt::bench::ns_per_op(keys.size(), [&] {
+		std::size_t acc = 0;
+		for (path_t const& key : keys) { acc += Hash{}(key); }
+		kt::bench::do_not_optimize(acc);
+	}));
+	std::unordered_set<path_t, Hash> set(keys.begin(), keys.begin() + static_cast<std::ptrdiff_t>(keys.size() / 2));
+	kt::bench::report("hash", (std::string(name) + " unordered_set find").c_str(), kt::bench::ns_per_op(keys.size(), [&] {
+		std::size_t found = 0;
+		for (path_t const& key : keys) { found += set.count(key); }
+		kt::bench::do_not_optimize(found);
+	}));
+}
+} // namespace
+
+KT_BENCH(hash) {
+	std::vector<path_t> const keys = make_keys(std::size_t{1} << 20);
+	run<std::hash<path_t>>("std::hash<fixed_vector> (bulk bytes)", keys);
+	run<combine_hash>("element-wise hash_combine", keys);
+	return true;
+}
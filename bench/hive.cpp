@@ -0,0 +1,72 @@
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+#include "bench.hpp"
+#include "fixed_hive.hpp"
+
+namespace {
+constexpr std::size_t hive_size = std::size_t{1} << 16;
+
+struct particle_t {
+	float position[3];
+	float velocity[3];
+	std::uint64_t id;
+};
+
+// Slot array with a live flag per element: the skip-by-flag iteration the hive's bitmask replaces
+struct flagged_t {
+	particle_t value;
+	bool live;
+};
+} // namespace
+
+// fixed_hive iteration at 10 / 50 / 90% fill against a live-flag slot array and a dense std::vector of the survivors
+KT_BENCH(hive) {
+	bool ok = true;
+	for (std::uint32_t const percent : {10U, 50U, 90U}) {
+		auto hive = std::make_unique<kt::fixed_hive<particle_t, hive_size>>();
+		std::vector<flagged_t> flagged(hive_size);
+		std::vector<particle_t const*> slots;
+		for (std::size_t i = 0; i < hive_size; ++i) {
+			particle_t const p{{0, 0, 0}, {1, 1, 1}, i};
+			slots.push_back(&*hive->insert(p));
+			flagged[i] = {p, true};
+		}
+		// erase a random (100 - percent)% of the slots, leaving the survivors scattered
+		kt::bench::rng rng;
+		for (std::size_t i = 0; i < hive_size; ++i) {
+			if (rng.below(100) >= percent) {
+				hive->erase(slots[i]);
+				flagged[i].live = false;
+			}
+		}
+		std::vector<particle_t> dense;
+		for (flagged_t const& f : flagged) {
+			if (f.live) { dense.push_back(f.value); }
+		}
+		std::string const suffix = " " + std::to_string(percent) + "% full";
+		std::uint64_t hive_sum = 0;
+		kt::bench::report("hive", ("fixed_hive" + suffix).c_str(), kt::bench::ns_per_op(dense.size(), [&] {
+			hive_sum = 0;
+			for (particle_t const& p : *hive) { hive_sum += p.id; }
+			kt::bench::do_not_optimize(hive_sum);
+		}));
+		std::uint64_t flagged_sum = 0;
+		kt::bench::report("hive", ("live-flag slot array" + suffix).c_str(), kt::bench::ns_per_op(dense.size(), [&] {
+			flagged_sum = 0;
+			for (flagged_t const& f : flagged) {
+				if (f.live) { flagged_sum += f.value.id; }
+			}
+			kt::bench::do_not_optimize(flagged_sum);
+		}));
+		std::uint64_t dense_sum = 0;
+		kt::bench::report("hive", ("dense std::vector" + suffix).c_str(), kt::bench::ns_per_op(dense.size(), [&] {
+			dense_sum = 0;
+			for (particle_t const& p : dense) { dense_sum += p.id; }
+			kt::bench::do_not_optimize(dense_sum);
+		}));
+		ok = ok && hive->size() == dense.size() && hive_sum == dense_sum && flagged_sum == dense_sum;
+	}
+	return ok;
+}
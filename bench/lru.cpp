@@ -0,0 +1,84 @@
+#include <cmath>
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "bench.hpp"
+#include "fixed_lru.hpp"
+
+namespace {
+constexpr std::size_t cache_size = 4096;
+constexpr std::size_t trace_size = std::size_t{1} << 20;
+constexpr double key_universe = 1 << 20;
+
+// The node-based LRU fixed_lru replaces: std::list in recency order plus an unordered_map of list iterators
+class list_lru {
+  public:
+	explicit list_lru(std::size_t capacity) : m_capacity(capacity) { m_index.reserve(capacity); }
+
+	// Returns whether key was cached; inserts it (evicting the tail) if not
+	bool access(std::uint32_t key) {
+		if (auto const it = m_index.find(key); it != m_index.end()) {
+			m_order.splice(m_order.begin(), m_order, it->second);
+			return true;
+		}
+		if (m_order.size() == m_capacity) {
+			m_index.erase(m_order.back().first);
+			m_order.pop_back();
+		}
+		m_order.emplace_front(key, key);
+		m_index.emplace(key, m_order.begin());
+		return false;
+	}
+
+  private:
+	using entry_t = std::pair<std::uint32_t, std::uint64_t>;
+
+	std::size_t m_capacity;
+	std::list<entry_t> m_order;
+	std::unordered_map<std::uint32_t, std::list<entry_t>::iterator> m_index;
+};
+
+template <kt::lru_policy Policy>
+using cache_t = kt::fixed_lru<std::uint32_t, std::uint64_t, cache_size, Policy>;
+
+template <kt::lru_policy Policy>
+bool access(cache_t<Policy>& cache, std::uint32_t key) {
+	if (cache.find(key)) { return true; }
+	cache.try_emplace(key, key);
+	return false;
+}
+
+// Returns the hits of the last pass
+template <typename Access>
+std::size_t run(char const* name, std::vector<std::uint32_t> const& trace, Access&& access) {
+	std::size_t hits = 0;
+	double const ns = kt::bench::ns_per_op(trace.size(), [&] {
+		hits = 0;
+		for (std::uint32_t const key : trace) { hits += access(key); }
+		kt::bench::do_not_optimize(hits);
+	});
+	kt::bench::report("lru", name, ns);
+	std::printf("%-20s %-48s %10.2f %% hits\n", "lru", name, 100.0 * static_cast<double>(hits) / static_cast<double>(trace.size()));
+	return hits;
+}
+} // namespace
+
+// Hit rate and per-access latency of a 4k-entry cache over a skewed (log-uniform, roughly Zipf s=1) trace of 1M keys from a 1M universe
+KT_BENCH(lru) {
+	kt::bench::rng rng;
+	std::vector<std::uint32_t> trace(trace_size);
+	for (std::uint32_t& key : trace) {
+		double const u = static_cast<double>(rng() >> 11) / 9007199254740992.0;
+		key = static_cast<std::uint32_t>(std::pow(key_universe, u)) - 1;
+	}
+	list_lru list(cache_size);
+	std::size_t const list_hits = run("std::list + std::unordered_map", trace, [&list](std::uint32_t key) { return list.access(key); });
+	auto exact = std::make_unique<cache_t<kt::lru_policy::lru>>();
+	// exact LRU must hit exactly where the list baseline does
+	std::size_t const exact_hits = run("fixed_lru lru", trace, [&exact](std::uint32_t key) { return access(*exact, key); });
+	auto clock = std::make_unique<cache_t<kt::lru_policy::clock>>();
+	run("fixed_lru clock", trace, [&clock](std::uint32_t key) { return access(*clock, key); });
+	return exact_hits == list_hits && exact->size() == cache_size && clock->size() == cache_size;
+}
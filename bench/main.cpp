@@ -0,0 +1,17 @@
+#include <cstring>
+#include "bench.hpp"
+
+// Usage: kt_bench [name...]; runs every benchmark whose name starts with one of the arguments (all if none)
+int main(int argc, char** argv) {
+	int failed = 0;
+	for (auto const& entry : kt::bench::registry()) {
+		bool selected = argc < 2;
+		for (int i = 1; i < argc && !selected; ++i) { selected = std::strncmp(entry.name, argv[i], std::strlen(argv[i])) == 0; }
+		if (!selected) { continue; }
+		if (!entry.run()) {
+			std::printf("%s: FAILED\n", entry.name);
+			++failed;
+		}
+	}
+	return failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,89 @@
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
+#include "bench.hpp"
+#include "fixed_quantile_sketch.hpp"
+
+namespace {
+constexpr std::size_t sample_count = std::size_t{1} << 21;
+constexpr std::size_t sketch_k = 1024;
+constexpr std::size_t sketch_levels = 12;
+// Worst-case normalized rank error tolerated over the probed quantiles
+constexpr double max_rank_error = 0.005;
+
+using sketch_t = kt::fixed_quantile_sketch<sketch_k, sketch_levels>;
+
+// Heavy-tailed lognormal samples via Box-Muller
+std::vector<float> make_samples(kt::bench::rng& rng) {
+	std::vector<float> ret(sample_count);
+	for (std::size_t i = 0; i < ret.size(); i += 2) {
+		double const u1 = (static_cast<double>(rng() >> 11) + 1.0) / 9007199254740993.0;
+		double const u2 = static_cast<double>(rng() >> 11) / 9007199254740992.0;
+		double const r = std::sqrt(-2.0 * std::log(u1));
+		ret[i] = static_cast<float>(std::exp(r * std::cos(6.283185307179586 * u2)));
+		if (i + 1 < ret.size()) { ret[i + 1] = static_cast<float>(std::exp(r * std::sin(6.283185307179586 * u2))); }
+	}
+	return ret;
+}
+
+// Largest |true rank of quantile(q) - q| over q = 0.001, 0.01, 0.02, ..., 0.99, 0.999 against the exactly sorted input
+double worst_rank_error(sketch_t const& sketch, std::vector<float> const& sorted) {
+	std::vector<double> probes{0.001, 0.999};
+	for (int i = 1; i < 100; ++i) { probes.push_back(i / 100.0); }
+	double ret = 0.0;
+	for (double const q : probes) {
+		float const estimate = sketch.quantile(q);
+		// the estimate is a retained sample, so any rank in [first, last) of its equal range is exact
+		double const lo = static_cast<double>(std::lower_bound(sorted.begin(), sorted.end(), estimate) - sorted.begin()) / static_cast<double>(sorted.size());
+		double const hi = static_cast<double>(std::upper_bound(sorted.begin(), sorted.end(), estimate) - sorted.begin()) / static_cast<double>(sorted.size());
+		double const error = q < lo ? lo - q : (q > hi ? q - hi : 0.0);
+		ret = error > ret ? error : ret;
+	}
+	return ret;
+}
+} // namespace
+
+// fixed_quantile_sketch accuracy against exact sorting (fails past max_rank_error) and insert / query throughput
+KT_BENCH(quantile) {
+	kt::bench::rng rng;
+	std::vector<float> const samples = make_samples(rng);
+	std::vector<float> sorted = samples;
+	std::sort(sorted.begin(), sorted.end());
+
+	auto sketch = std::make_unique<sketch_t>();
+	sketch->insert(samples.begin(), samples.end());
+	double const single = worst_rank_error(*sketch, sorted);
+
+	// the same stream split over 8 sketches and merged
+	constexpr std::size_t shards = 8;
+	auto merged = std::make_unique<sketch_t>();
+	for (std::size_t s = 0; s < shards; ++s) {
+		auto shard = std::make_unique<sketch_t>();
+		auto const first = samples.begin() + static_cast<std::ptrdiff_t>(s * sample_count / shards);
+		auto const last = samples.begin() + static_cast<std::ptrdiff_t>((s + 1) * sample_count / shards);
+		shard->insert(first, last);
+		merged->merge(*shard);
+	}
+	double const combined = worst_rank_error(*merged, sorted);
+	std::printf("%-20s %-48s %10.4f (retained %zu of %zu)\n", "quantile", "worst rank error, single sketch", single, sketch->retained(), sample_count);
+	std::printf("%-20s %-48s %10.4f (retained %zu)\n", "quantile", "worst rank error, 8 merged shards", combined, merged->retained());
+
+	kt::bench::report("quantile", "insert", kt::bench::ns_per_op(sample_count, [&] {
+		sketch->clear();
+		sketch->insert(samples.begin(), samples.end());
+		kt::bench::do_not_optimize(sketch->retained());
+	}));
+	kt::bench::report("quantile", "quantile(q)", kt::bench::ns_per_op(100, [&] {
+		float acc = 0.0f;
+		for (int i = 0; i < 100; ++i) { acc += sketch->quantile(i / 100.0); }
+		kt::bench::do_not_optimize(acc);
+	}));
+	kt::bench::report("quantile", "exact std::nth_element", kt::bench::ns_per_op(1, [&] {
+		std::vector<float> copy = samples;
+		std::nth_element(copy.begin(), copy.begin() + static_cast<std::ptrdiff_t>(copy.size() / 2), copy.end());
+		kt::bench::do_not_optimize(copy[copy.size() / 2]);
+	}));
+	return single <= max_rank_error && combined <= max_rank_error;
+}
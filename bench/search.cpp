@@ -0,0 +1,52 @@
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+#include "bench.hpp"
+#include "sorted_fixed_vector.hpp"
+
+namespace {
+constexpr std::size_t query_count = std::size_t{1} << 16;
+
+template <std::size_t N>
+bool search_n() {
+	kt::bench::rng rng;
+	std::vector<std::uint32_t> sorted(N);
+	for (std::uint32_t& t : sorted) { t = static_cast<std::uint32_t>(rng() >> 32); }
+	std::sort(sorted.begin(), sorted.end());
+	auto const tree = std::make_unique<kt::eytzinger_fixed_vector<std::uint32_t, N>>(sorted.begin(), sorted.end());
+	std::vector<std::uint32_t> queries(query_count);
+	for (std::uint32_t& q : queries) { q = static_cast<std::uint32_t>(rng() >> 32); }
+
+	std::string const suffix = " N=" + std::to_string(N);
+	std::uint64_t std_sum = 0;
+	kt::bench::report("lower_bound", ("std::lower_bound" + suffix).c_str(), kt::bench::ns_per_op(query_count, [&] {
+		std_sum = 0;
+		for (std::uint32_t const q : queries) {
+			auto const it = std::lower_bound(sorted.begin(), sorted.end(), q);
+			std_sum += it == sorted.end() ? 0 : *it;
+		}
+		kt::bench::do_not_optimize(std_sum);
+	}));
+	std::uint64_t kt_sum = 0;
+	kt::bench::report("lower_bound", ("eytzinger_fixed_vector" + suffix).c_str(), kt::bench::ns_per_op(query_count, [&] {
+		kt_sum = 0;
+		for (std::uint32_t const q : queries) {
+			std::uint32_t const* ret = tree->lower_bound(q);
+			kt_sum += ret ? *ret : 0;
+		}
+		kt::bench::do_not_optimize(kt_sum);
+	}));
+	return std_sum == kt_sum;
+}
+} // namespace
+
+// eytzinger_fixed_vector::lower_bound against std::lower_bound on a sorted array, from L1-resident to DRAM-resident N
+KT_BENCH(lower_bound) {
+	bool ok = search_n<std::size_t{1} << 10>();
+	ok = search_n<std::size_t{1} << 14>() && ok;
+	ok = search_n<std::size_t{1} << 18>() && ok;
+	ok = search_n<std::size_t{1} << 22>() && ok;
+	ok = search_n<std::size_t{1} << 25>() && ok;
+	return ok;
+}
@@ -0,0 +1,110 @@
+#include <memory>
+#include <queue>
+#include <set>
+#include <string>
+#include <vector>
+#include "bench.hpp"
+#include "fixed_priority_queue.hpp"
+
+namespace {
+constexpr std::size_t timer_count = std::size_t{1} << 16;
+constexpr std::size_t step_count = std::size_t{1} << 16;
+
+struct timer_entry {
+	std::uint64_t deadline;
+	std::uint32_t id;
+};
+// Earliest deadline on top
+struct later {
+	bool operator()(timer_entry const& lhs, timer_entry const& rhs) const noexcept { return lhs.deadline > rhs.deadline || (lhs.deadline == rhs.deadline && lhs.id > rhs.id); }
+};
+// Keeps each timer's heap index for reschedule / cancel
+struct track_position {
+	std::uint32_t* positions;
+	void operator()(timer_entry const& t, std::size_t index) const noexcept { positions[t.id] = static_cast<std::uint32_t>(index); }
+};
+
+template <std::size_t Arity, typename OnMove = track_position>
+using queue_t = kt::fixed_priority_queue<timer_entry, timer_count, later, Arity, OnMove>;
+
+std::vector<timer_entry> make_timers(kt::bench::rng& rng) {
+	std::vector<timer_entry> ret(timer_count);
+	for (std::uint32_t id = 0; id < timer_count; ++id) { ret[id] = {rng.below(1U << 20), id}; }
+	return ret;
+}
+
+// Fire the earliest timer and re-arm it a random delay later, step_count times; returns a checksum of fired ids
+template <std::size_t Arity, typename OnMove>
+std::uint64_t fire_kt(std::vector<timer_entry> const& timers, OnMove on_move) {
+	auto queue = std::make_unique<queue_t<Arity, OnMove>>(later{}, on_move);
+	queue->heapify(timers.begin(), timers.end());
+	kt::bench::rng rng;
+	std::uint64_t ret = 0;
+	for (std::size_t step = 0; step < step_count; ++step) {
+		timer_entry const top = queue->top();
+		ret = ret * 31 + top.id;
+		queue->pop_push({top.deadline + 1 + rng.below(1U << 20), top.id});
+	}
+	return ret;
+}
+std::uint64_t fire_std(std::vector<timer_entry> const& timers) {
+	std::priority_queue<timer_entry, std::vector<timer_entry>, later> queue(later{}, timers);
+	kt::bench::rng rng;
+	std::uint64_t ret = 0;
+	for (std::size_t step = 0; step < step_count; ++step) {
+		timer_entry const top = queue.top();
+		ret = ret * 31 + top.id;
+		queue.pop();
+		queue.push({top.deadline + 1 + rng.below(1U << 20), top.id});
+	}
+	return ret;
+}
+} // namespace
+
+// Scheduler workloads over 64k pending timers: fire and re-arm the earliest, and reschedule arbitrary timers by id
+KT_BENCH(timer) {
+	kt::bench::rng rng;
+	std::vector<timer_entry> const timers = make_timers(rng);
+	std::vector<std::uint32_t> positions(timer_count);
+
+	std::uint64_t std_sum = 0;
+	std::uint64_t kt_sums[3] = {};
+	// each call also rebuilds the heap, the same O(n) heapify for every variant
+	kt::bench::report("timer", "fire std::priority_queue pop + push", kt::bench::ns_per_op(step_count, [&] { std_sum = fire_std(timers); }));
+	kt::bench::report("timer", "fire fixed_priority_queue<2> pop_push", kt::bench::ns_per_op(step_count, [&] { kt_sums[0] = fire_kt<2>(timers, kt::detail::heap_no_tracking{}); }));
+	kt::bench::report("timer", "fire fixed_priority_queue<4> pop_push", kt::bench::ns_per_op(step_count, [&] { kt_sums[1] = fire_kt<4>(timers, kt::detail::heap_no_tracking{}); }));
+	kt::bench::report("timer", "fire fixed_priority_queue<4> pop_push tracked", kt::bench::ns_per_op(step_count, [&] {
+		kt_sums[2] = fire_kt<4>(timers, track_position{positions.data()});
+	}));
+	bool ok = std_sum == kt_sums[0] && std_sum == kt_sums[1] && std_sum == kt_sums[2];
+
+	// reschedule random timers by id: std::set erase + insert against update() through the tracked heap index
+	std::vector<std::uint32_t> ids(step_count);
+	std::vector<std::uint64_t> deadlines(step_count);
+	for (std::size_t i = 0; i < step_count; ++i) {
+		ids[i] = rng.below(timer_count);
+		deadlines[i] = rng.below(1U << 20);
+	}
+	auto const set_less = [](timer_entry const& lhs, timer_entry const& rhs) { return later{}(rhs, lhs); };
+	std::set<timer_entry, decltype(set_less)> set(timers.begin(), timers.end(), set_less);
+	std::vector<std::uint64_t> current(timer_count);
+	for (timer_entry const& t : timers) { current[t.id] = t.deadline; }
+	kt::bench::report("timer", "reschedule std::set erase + insert", kt::bench::ns_per_op(step_count, [&] {
+		for (std::size_t i = 0; i < step_count; ++i) {
+			std::uint32_t const id = ids[i];
+			set.erase({current[id], id});
+			current[id] = deadlines[i];
+			set.insert({deadlines[i], id});
+		}
+	}));
+	auto queue = std::make_unique<queue_t<4>>(later{}, track_position{positions.data()});
+	queue->heapify(timers.begin(), timers.end());
+	kt::bench::report("timer", "reschedule fixed_priority_queue<4> update", kt::bench::ns_per_op(step_count, [&] {
+		for (std::size_t i = 0; i < step_count; ++i) {
+			std::uint64_t const deadline = deadlines[i];
+			queue->update(positions[ids[i]], [deadline](timer_entry& t) { t.deadline = deadline; });
+		}
+	}));
+	ok = ok && set.size() == queue->size() && set.begin()->id == queue->top().id;
+	return ok;
+}
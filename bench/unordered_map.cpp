@@ -0,0 +1,145 @@
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "bench.hpp"
+#include "fixed_unordered_map.hpp"
+
+namespace {
+constexpr std::size_t map_size = std::size_t{1} << 16;
+
+// Baseline flat map in the style of the absl / folly "flat" maps without SIMD control bytes:
+// one occupancy byte per slot, linear probing, backward-shift erase, power-of-two slots at the same 7/8 load bound
+class linear_probe_map {
+  public:
+	explicit linear_probe_map(std::size_t capacity) {
+		std::size_t slots = 16;
+		while (slots < capacity + capacity / 7 + 1) { slots *= 2; }
+		m_keys.resize(slots);
+		m_values.resize(slots);
+		m_full.resize(slots);
+	}
+
+	bool insert(std::uint64_t key, std::uint64_t value) {
+		for (std::size_t i = home(key);; i = next(i)) {
+			if (!m_full[i]) {
+				m_full[i] = 1;
+				m_keys[i] = key;
+				m_values[i] = value;
+				return true;
+			}
+			if (m_keys[i] == key) { return false; }
+		}
+	}
+	std::uint64_t const* find(std::uint64_t key) const {
+		for (std::size_t i = home(key); m_full[i]; i = next(i)) {
+			if (m_keys[i] == key) { return &m_values[i]; }
+		}
+		return nullptr;
+	}
+	bool erase(std::uint64_t key) {
+		std::size_t i = home(key);
+		for (; m_full[i]; i = next(i)) {
+			if (m_keys[i] == key) { break; }
+		}
+		if (!m_full[i]) { return false; }
+		for (std::size_t j = next(i); m_full[j]; j = next(j)) {
+			std::size_t const h = home(m_keys[j]);
+			// move j back into the hole at i unless its home lies cyclically in (i, j]
+			if (((j - h) & mask()) >= ((j - i) & mask())) {
+				m_keys[i] = m_keys[j];
+				m_values[i] = m_values[j];
+				i = j;
+			}
+		}
+		m_full[i] = 0;
+		return true;
+	}
+
+  private:
+	std::size_t mask() const noexcept { return m_keys.size() - 1; }
+	std::size_t home(std::uint64_t key) const noexcept { return static_cast<std::size_t>(kt::detail::hash_mix(key)) & mask(); }
+	std::size_t next(std::size_t i) const noexcept { return (i + 1) & mask(); }
+
+	std::vector<std::uint64_t> m_keys;
+	std::vector<std::uint64_t> m_values;
+	std::vector<std::uint8_t> m_full;
+};
+
+template <typename Map>
+struct ops_t;
+
+template <>
+struct ops_t<std::unordered_map<std::uint64_t, std::uint64_t>> {
+	using map_t = std::unordered_map<std::uint64_t, std::uint64_t>;
+	static std::unique_ptr<map_t> make() {
+		auto ret = std::make_unique<map_t>();
+		ret->reserve(map_size);
+		return ret;
+	}
+	static void insert(map_t& map, std::uint64_t key) { map.emplace(key, key); }
+	static bool contains(map_t const& map, std::uint64_t key) { return map.find(key) != map.end(); }
+	static void erase(map_t& map, std::uint64_t key) { map.erase(key); }
+};
+template <>
+struct ops_t<linear_probe_map> {
+	using map_t = linear_probe_map;
+	static std::unique_ptr<map_t> make() { return std::make_unique<map_t>(map_size); }
+	static void insert(map_t& map, std::uint64_t key) { map.insert(key, key); }
+	static bool contains(map_t const& map, std::uint64_t key) { return map.find(key) != nullptr; }
+	static void erase(map_t& map, std::uint64_t key) { map.erase(key); }
+};
+template <>
+struct ops_t<kt::fixed_unordered_map<std::uint64_t, std::uint64_t, map_size>> {
+	using map_t = kt::fixed_unordered_map<std::uint64_t, std::uint64_t, map_size>;
+	static std::unique_ptr<map_t> make() { return std::make_unique<map_t>(); }
+	static void insert(map_t& map, std::uint64_t key) { map.try_emplace(key, key); }
+	static bool contains(map_t const& map, std::uint64_t key) { return map.find(key) != map.end(); }
+	static void erase(map_t& map, std::uint64_t key) { map.erase(key); }
+};
+
+// Fill to map_size, then time lookups of present and absent keys and an erase / reinsert churn; returns the number of hits seen
+template <typename Map>
+std::size_t run(char const* name, std::vector<std::uint64_t> const& keys, std::vector<std::uint64_t> const& absent) {
+	using ops = ops_t<Map>;
+	auto map = ops::make();
+	std::string const prefix = name;
+	kt::bench::report("unordered_map", (prefix + " insert").c_str(), kt::bench::ns_per_op(keys.size(), [&] {
+		map = ops::make();
+		for (std::uint64_t const key : keys) { ops::insert(*map, key); }
+	}));
+	std::size_t hits = 0;
+	kt::bench::report("unordered_map", (prefix + " find hit").c_str(), kt::bench::ns_per_op(keys.size(), [&] {
+		hits = 0;
+		for (std::uint64_t const key : keys) { hits += ops::contains(*map, key); }
+		kt::bench::do_not_optimize(hits);
+	}));
+	std::size_t misses = 0;
+	kt::bench::report("unordered_map", (prefix + " find miss").c_str(), kt::bench::ns_per_op(absent.size(), [&] {
+		misses = 0;
+		for (std::uint64_t const key : absent) { misses += !ops::contains(*map, key); }
+		kt::bench::do_not_optimize(misses);
+	}));
+	kt::bench::report("unordered_map", (prefix + " erase + insert").c_str(), kt::bench::ns_per_op(keys.size(), [&] {
+		for (std::uint64_t const key : keys) {
+			ops::erase(*map, key);
+			ops::insert(*map, key);
+		}
+	}));
+	return hits + misses;
+}
+} // namespace
+
+// fixed_unordered_map against std::unordered_map and a scalar linear-probing flat map, 64k uint64 keys at the 7/8 load bound
+KT_BENCH(unordered_map) {
+	kt::bench::rng rng;
+	std::vector<std::uint64_t> keys(map_size);
+	std::vector<std::uint64_t> absent(map_size);
+	// even keys are present and odd keys absent, so the two sets never overlap
+	for (std::uint64_t& key : keys) { key = rng() & ~std::uint64_t{1}; }
+	for (std::uint64_t& key : absent) { key = rng() | 1; }
+	std::size_t const expected = run<std::unordered_map<std::uint64_t, std::uint64_t>>("std::unordered_map", keys, absent);
+	bool ok = run<linear_probe_map>("linear probing", keys, absent) == expected;
+	ok = run<kt::fixed_unordered_map<std::uint64_t, std::uint64_t, map_size>>("kt::fixed_unordered_map", keys, absent) == expected && ok;
+	return ok;
+}
@@ -0,0 +1,206 @@
+// KT header-only library
+// Requirements: C++17
+
+#pragma once
+#include <tuple>
+#include "fixed_vector.hpp"
+
+namespace kt {
+namespace detail {
+// Largest power of two dividing a column's byte size, capped at a cache line
+template <typename T, std::size_t Lanes>
+constexpr std::size_t lane_alignment_v = [] {
+	constexpr std::size_t bytes = sizeof(T) * Lanes;
+	constexpr std::size_t pow2 = bytes & (~bytes + 1);
+	constexpr std::size_t ret = pow2 < 64 ? pow2 : 64;
+	return ret < alignof(T) ? alignof(T) : ret;
+}();
+
+template <typename T, std::size_t Lanes>
+struct alignas(lane_alignment_v<T, Lanes>) lane_array {
+	T lanes[Lanes];
+};
+} // namespace detail
+
+///
+/// \brief Array-of-structures-of-arrays vector: elements are grouped in tiles of Lanes,
+/// each tile holding one aligned column per field
+/// Ts must be trivial; lanes past size() in the last tile hold unspecified values
+///
+template <std::size_t Lanes, std::size_t N, typename... Ts>
+class fixed_aosoa_vector {
+	static_assert(Lanes > 0 && Lanes <= 64, "Lanes must be in [1, 64]");
+	static_assert(sizeof...(Ts) > 0, "At least one column required");
+	static_assert((std::is_trivial_v<Ts> && ...), "Ts must be trivial");
+
+	struct tile_t {
+		std::tuple<detail::lane_array<Ts, Lanes>...> columns;
+	};
+
+  public:
+	using size_type = std::size_t;
+	using value_type = std::tuple<Ts...>;
+	using reference = std::tuple<Ts&...>;
+	using const_reference = std::tuple<Ts const&...>;
+	template <std::size_t I>
+	using column_t = std::tuple_element_t<I, value_type>;
+
+	static constexpr size_type lanes = Lanes;
+	static constexpr size_type max_tiles = (N + Lanes - 1) / Lanes;
+	static constexpr size_type max_size() noexcept { return N; }
+
+	///
+	/// \brief One tile: Lanes slots per column, of which size() are live
+	///
+	template <bool IsConst>
+	class tile_view {
+		using tile_ptr = std::conditional_t<IsConst, tile_t const*, tile_t*>;
+		template <typename T>
+		using type_t = std::conditional_t<IsConst, T const, T>;
+
+	  public:
+		tile_view() = default;
+
+		///
+		/// \brief Aligned pointer to Lanes values of column I
+		///
+		template <std::size_t I>
+		type_t<column_t<I>>* column() const noexcept {
+			return std::get<I>(m_tile->columns).lanes;
+		}
+		size_type size() const noexcept { return m_size; }
+		bool full() const noexcept { return m_size == Lanes; }
+		///
+		/// \brief Bit i set for each live lane i
+		///
+		std::uint64_t mask() const noexcept { return m_size >= 64 ? ~std::uint64_t{} : (std::uint64_t{1} << m_size) - 1; }
+
+	  private:
+		tile_view(tile_ptr tile, size_type size) noexcept : m_tile(tile), m_size(size) {}
+
+		tile_ptr m_tile{};
+		size_type m_size{};
+
+		friend class fixed_aosoa_vector;
+	};
+
+	template <bool IsConst>
+	class tile_iter_t {
+		using vec_t = std::conditional_t<IsConst, fixed_aosoa_vector const, fixed_aosoa_vector>;
+
+	  public:
+		using iterator_category = std::forward_iterator_tag;
+		using value_type = tile_view<IsConst>;
+		using difference_type = std::ptrdiff_t;
+		using pointer = void;
+		using reference = value_type;
+
+		tile_iter_t() = default;
+
+		value_type operator*() const noexcept { return m_vec->tile(m_index); }
+		tile_iter_t& operator++() noexcept { return (++m_index, *this); }
+		tile_iter_t operator++(int) noexcept { return tile_iter_t(m_vec, m_index++); }
+
+		friend bool operator==(tile_iter_t const& lhs, tile_iter_t const& rhs) noexcept { return lhs.m_vec == rhs.m_vec && lhs.m_index == rhs.m_index; }
+		friend bool operator!=(tile_iter_t const& lhs, tile_iter_t const& rhs) noexcept { return !(lhs == rhs); }
+
+	  private:
+		tile_iter_t(vec_t* vec, size_type index) noexcept : m_vec(vec), m_index(index) {}
+
+		vec_t* m_vec{};
+		size_type m_index{};
+
+		friend class fixed_aosoa_vector;
+	};
+
+	template <typename Iter>
+	struct tile_range {
+		Iter first;
+		Iter last;
+
+		Iter begin() const noexcept { return first; }
+		Iter end() const noexcept { return last; }
+	};
+
+	reference at(size_type index) noexcept { return at(index, indices{}); }
+	const_reference at(size_type index) const noexcept { return at(index, indices{}); }
+	reference operator[](size_type index) noexcept { return at(index); }
+	const_reference operator[](size_type index) const noexcept { return at(index); }
+	reference back() noexcept { return at(m_size - 1); }
+	const_reference back() const noexcept { return at(m_size - 1); }
+
+	///
+	/// \brief Number of tiles holding live elements; only the last may be partial
+	///
+	size_type tile_count() const noexcept { return (m_size + Lanes - 1) / Lanes; }
+	tile_view<false> tile(size_type index) noexcept;
+	tile_view<true> tile(size_type index) const noexcept;
+	tile_range<tile_iter_t<false>> tiles() noexcept { return {tile_iter_t<false>(this, 0), tile_iter_t<false>(this, tile_count())}; }
+	tile_range<tile_iter_t<true>> tiles() const noexcept { return {tile_iter_t<true>(this, 0), tile_iter_t<true>(this, tile_count())}; }
+
+	bool empty() const noexcept { return m_size == 0; }
+	size_type size() const noexcept { return m_size; }
+	constexpr size_type capacity() const noexcept { return N; }
+	bool has_space() const noexcept { return m_size < N; }
+
+	void clear() noexcept { m_size = 0; }
+	reference push_back(Ts const&... ts);
+	reference push_back(value_type const& value) { return std::apply([this](Ts const&... ts) -> reference { return push_back(ts...); }, value); }
+	void pop_back() noexcept {
+		assert(!empty());
+		--m_size;
+	}
+	///
+	/// \brief Erase element at index by moving back() into it; does not preserve order
+	///
+	void erase_unordered(size_type index) noexcept;
+
+  private:
+	using indices = std::index_sequence_for<Ts...>;
+
+	template <std::size_t... I>
+	reference at(size_type index, std::index_sequence<I...>) noexcept {
+		assert(index < m_size);
+		tile_t& t = m_tiles[index / Lanes];
+		return reference(std::get<I>(t.columns).lanes[index % Lanes]...);
+	}
+	template <std::size_t... I>
+	const_reference at(size_type index, std::index_sequence<I...>) const noexcept {
+		assert(index < m_size);
+		tile_t const& t = m_tiles[index / Lanes];
+		return const_reference(std::get<I>(t.columns).lanes[index % Lanes]...);
+	}
+
+	std::array<tile_t, max_tiles> m_tiles;
+	size_type m_size = 0;
+};
+
+// impl
+
+template <std::size_t Lanes, std::size_t N, typename... Ts>
+auto fixed_aosoa_vector<Lanes, N, Ts...>::tile(size_type index) noexcept -> tile_view<false> {
+	assert(index < tile_count());
+	size_type const live = m_size - index * Lanes;
+	return tile_view<false>(&m_tiles[index], live < Lanes ? live : Lanes);
+}
+template <std::size_t Lanes, std::size_t N, typename... Ts>
+auto fixed_aosoa_vector<Lanes, N, Ts...>::tile(size_type index) const noexcept -> tile_view<true> {
+	assert(index < tile_count());
+	size_type const live = m_size - index * Lanes;
+	return tile_view<true>(&m_tiles[index], live < Lanes ? live : Lanes);
+}
+template <std::size_t Lanes, std::size_t N, typename... Ts>
+typename fixed_aosoa_vector<Lanes, N, Ts...>::reference fixed_aosoa_vector<Lanes, N, Ts...>::push_back(Ts const&... ts) {
+	assert(has_space());
+	++m_size;
+	reference ret = back();
+	ret = std::forward_as_tuple(ts...);
+	return ret;
+}
+template <std::size_t Lanes, std::size_t N, typename... Ts>
+void fixed_aosoa_vector<Lanes, N, Ts...>::erase_unordered(size_type index) noexcept {
+	assert(index < m_size);
+	if (index + 1 < m_size) { at(index) = const_reference(back()); }
+	--m_size;
+}
+} // namespace kt
@@ -0,0 +1,226 @@
+// KT header-only library
+// Requirements: C++17
+
+#pragma once
+#include "fixed_vector.hpp"
+
+namespace kt {
+///
+/// \brief Bit-packed vector of up to N bools on inline 64-bit words
+/// Bits past size() are kept clear, so counts, searches and boolean ops work a word at a time
+///
+template <std::size_t N>
+class fixed_bitvector {
+  public:
+	using size_type = std::size_t;
+	using value_type = bool;
+	using word_type = std::uint64_t;
+
+	static constexpr size_type npos = static_cast<size_type>(-1);
+	static constexpr size_type word_bits = 64;
+	static constexpr size_type word_count = (N + word_bits - 1) / word_bits;
+	static constexpr size_type max_size() noexcept { return N; }
+
+	fixed_bitvector() = default;
+	explicit fixed_bitvector(size_type count, bool value = false) { resize(count, value); }
+
+	bool test(size_type index) const noexcept {
+		assert(index < m_size);
+		return (m_words[index / word_bits] >> (index % word_bits)) & 1U;
+	}
+	bool operator[](size_type index) const noexcept { return test(index); }
+	word_type const* words() const noexcept { return m_words.data(); }
+	///
+	/// \brief Number of words holding live bits
+	///
+	size_type words_in_use() const noexcept { return (m_size + word_bits - 1) / word_bits; }
+
+	bool empty() const noexcept { return m_size == 0; }
+	size_type size() const noexcept { return m_size; }
+	constexpr size_type capacity() const noexcept { return N; }
+	bool has_space() const noexcept { return m_size < N; }
+
+	size_type count() const noexcept;
+	bool any() const noexcept;
+	bool none() const noexcept { return !any(); }
+	bool all() const noexcept { return count() == m_size; }
+	///
+	/// \brief Index of the first set bit, or npos
+	///
+	size_type find_first() const noexcept { return find_from(0); }
+	///
+	/// \brief Index of the first set bit after index, or npos (also for index == npos)
+	///
+	size_type find_next(size_type index) const noexcept { return index >= m_size ? npos : find_from(index + 1); }
+
+	fixed_bitvector& set(size_type index, bool value = true) noexcept;
+	fixed_bitvector& reset(size_type index) noexcept { return set(index, false); }
+	fixed_bitvector& flip(size_type index) noexcept;
+	fixed_bitvector& set() noexcept;
+	fixed_bitvector& reset() noexcept;
+	fixed_bitvector& flip() noexcept;
+
+	void clear() noexcept;
+	void push_back(bool value) noexcept;
+	void pop_back() noexcept;
+	void resize(size_type count, bool value = false) noexcept;
+
+	// Operands must be of equal size
+	fixed_bitvector& operator&=(fixed_bitvector const& rhs) noexcept;
+	fixed_bitvector& operator|=(fixed_bitvector const& rhs) noexcept;
+	fixed_bitvector& operator^=(fixed_bitvector const& rhs) noexcept;
+	///
+	/// \brief Clear every bit that is set in rhs
+	///
+	fixed_bitvector& and_not(fixed_bitvector const& rhs) noexcept;
+
+	friend bool operator==(fixed_bitvector const& lhs, fixed_bitvector const& rhs) noexcept {
+		return lhs.m_size == rhs.m_size && std::equal(lhs.m_words.begin(), lhs.m_words.begin() + lhs.words_in_use(), rhs.m_words.begin());
+	}
+	friend bool operator!=(fixed_bitvector const& lhs, fixed_bitvector const& rhs) noexcept { return !(lhs == rhs); }
+
+  private:
+	size_type find_from(size_type index) const noexcept;
+	void clear_tail() noexcept;
+
+	std::array<word_type, word_count> m_words{};
+	size_type m_size = 0;
+};
+
+// impl
+
+template <std::size_t N>
+typename fixed_bitvector<N>::size_type fixed_bitvector<N>::count() const noexcept {
+	size_type ret = 0;
+	for (size_type w = 0; w < words_in_use(); ++w) { ret += static_cast<size_type>(detail::popcount(m_words[w])); }
+	return ret;
+}
+template <std::size_t N>
+bool fixed_bitvector<N>::any() const noexcept {
+	word_type acc = 0;
+	for (size_type w = 0; w < words_in_use(); ++w) { acc |= m_words[w]; }
+	return acc != 0;
+}
+template <std::size_t N>
+typename fixed_bitvector<N>::size_type fixed_bitvector<N>::find_from(size_type index) const noexcept {
+	if (index >= m_size) { return npos; }
+	size_type w = index / word_bits;
+	word_type word = m_words[w] & (~word_type{} << (index % word_bits));
+	size_type const end = words_in_use();
+	while (word == 0) {
+		if (++w >= end) { return npos; }
+		word = m_words[w];
+	}
+	return w * word_bits + static_cast<size_type>(detail::countr_zero(word));
+}
+template <std::size_t N>
+fixed_bitvector<N>& fixed_bitvector<N>::set(size_type index, bool value) noexcept {
+	assert(index < m_size);
+	word_type const bit = word_type{1} << (index % word_bits);
+	word_type& word = m_words[index / word_bits];
+	word = (word & ~bit) | (value ? bit : 0);
+	return *this;
+}
+template <std::size_t N>
+fixed_bitvector<N>& fixed_bitvector<N>::flip(size_type index) noexcept {
+	assert(index < m_size);
+	m_words[index / word_bits] ^= word_type{1} << (index % word_bits);
+	return *this;
+}
+template <std::size_t N>
+fixed_bitvector<N>& fixed_bitvector<N>::set() noexcept {
+	for (size_type w = 0; w < words_in_use(); ++w) { m_words[w] = ~word_type{}; }
+	clear_tail();
+	return *this;
+}
+template <std::size_t N>
+fixed_bitvector<N>& fixed_bitvector<N>::reset() noexcept {
+	for (size_type w = 0; w < words_in_use(); ++w) { m_words[w] = 0; }
+	return *this;
+}
+template <std::size_t N>
+fixed_bitvector<N>& fixed_bitvector<N>::flip() noexcept {
+	for (size_type w = 0; w < words_in_use(); ++w) { m_words[w] = ~m_words[w]; }
+	clear_tail();
+	return *this;
+}
+template <std::size_t N>
+void fixed_bitvector<N>::clear() noexcept {
+	reset();
+	m_size = 0;
+}
+template <std::size_t N>
+void fixed_bitvector<N>::push_back(bool value) noexcept {
+	assert(has_space());
+	m_words[m_size / word_bits] |= static_cast<word_type>(value) << (m_size % word_bits);
+	++m_size;
+}
+template <std::size_t N>
+void fixed_bitvector<N>::pop_back() noexcept {
+	assert(!empty());
+	--m_size;
+	m_words[m_size / word_bits] &= ~(word_type{1} << (m_size % word_bits));
+}
+template <std::size_t N>
+void fixed_bitvector<N>::resize(size_type count, bool value) noexcept {
+	assert(count <= N);
+	if (count < m_size) {
+		size_type const prev = words_in_use();
+		m_size = count;
+		for (size_type w = words_in_use(); w < prev; ++w) { m_words[w] = 0; }
+		clear_tail();
+		return;
+	}
+	if (value) {
+		// fill the rest of the current word, then whole words
+		size_type const first = m_size;
+		m_size = count;
+		if (first % word_bits != 0) { m_words[first / word_bits] |= ~word_type{} << (first % word_bits); }
+		for (size_type w = (first + word_bits - 1) / word_bits; w < words_in_use(); ++w) { m_words[w] = ~word_type{}; }
+		clear_tail();
+	} else {
+		m_size = count;
+	}
+}
+template <std::size_t N>
+fixed_bitvector<N>& fixed_bitvector<N>::operator&=(fixed_bitvector const& rhs) noexcept {
+	assert(m_size == rhs.m_size);
+	for (size_type w = 0; w < words_in_use(); ++w) { m_words[w] &= rhs.m_words[w]; }
+	return *this;
+}
+template <std::size_t N>
+fixed_bitvector<N>& fixed_bitvector<N>::operator|=(fixed_bitvector const& rhs) noexcept {
+	assert(m_size == rhs.m_size);
+	for (size_type w = 0; w < words_in_use(); ++w) { m_words[w] |= rhs.m_words[w]; }
+	return *this;
+}
+template <std::size_t N>
+fixed_bitvector<N>& fixed_bitvector<N>::operator^=(fixed_bitvector const& rhs) noexcept {
+	assert(m_size == rhs.m_size);
+	for (size_type w = 0; w < words_in_use(); ++w) { m_words[w] ^= rhs.m_words[w]; }
+	return *this;
+}
+template <std::size_t N>
+fixed_bitvector<N>& fixed_bitvector<N>::and_not(fixed_bitvector const& rhs) noexcept {
+	assert(m_size == rhs.m_size);
+	for (size_type w = 0; w < words_in_use(); ++w) { m_words[w] &= ~rhs.m_words[w]; }
+	return *this;
+}
+template <std::size_t N>
+void fixed_bitvector<N>::clear_tail() noexcept {
+	if (m_size % word_bits != 0) { m_words[m_size / word_bits] &= ~(~word_type{} << (m_size % word_bits)); }
+}
+
+template <std::size_t N>
+fixed_bitvector<N> operator&(fixed_bitvector<N> lhs, fixed_bitvector<N> const& rhs) noexcept {
+	return lhs &= rhs;
+}
+template <std::size_t N>
+fixed_bitvector<N> operator|(fixed_bitvector<N> lhs, fixed_bitvector<N> const& rhs) noexcept {
+	return lhs |= rhs;
+}
+template <std::size_t N>
+fixed_bitvector<N> operator^(fixed_bitvector<N> lhs, fixed_bitvector<N> const& rhs) noexcept {
+	return lhs ^= rhs;
+}
+} // namespace kt
@@ -0,0 +1,424 @@
+// KT header-only library
+// Requirements: C++17
+
+#pragma once
+#include "sorted_fixed_vector.hpp"
+
+namespace kt {
+namespace detail {
+// Keys per node that fill one 64 byte cache line
+template <typename K>
+inline constexpr std::size_t btree_fanout_v = 64 / sizeof(K) >= 4 ? 64 / sizeof(K) : 4;
+} // namespace detail
+
+///
+/// \brief Sorted associative container with unique keys on a B+tree drawn from inline node pools
+/// Up to Nodes leaves hold Fanout keys (and, in a separate array, values) each; leaves are linked for range
+/// iteration. Without erase, holds at least Nodes * Fanout / 2 entries in any insertion order, and up to
+/// Nodes * Fanout when bulk-loaded or appended in ascending order. Erase is lazy: nodes are never merged or
+/// released, so an emptied leaf keeps its key range and is refilled only by later inserts into that range;
+/// after erases, inserts elsewhere may run out of nodes below that bound.
+/// Inserts may move values within and across leaves: returned pointers are valid until the next insert.
+///
+template <typename K, typename V, std::size_t Nodes, std::size_t Fanout = detail::btree_fanout_v<K>, typename Compare = std::less<>>
+class fixed_btree_map {
+	static_assert(Fanout >= 4 && Fanout % 2 == 0, "Fanout must be even and at least 4");
+	// non-root inner nodes have at least Fanout / 2 children
+	static constexpr std::size_t inner_nodes_v = Nodes / (Fanout / 2 - 1) + 1;
+	using index_t = std::conditional_t<(inner_nodes_v < 0xffff && Nodes < 0xffff), std::uint16_t, std::uint32_t>;
+
+  public:
+	using size_type = std::size_t;
+	using key_type = K;
+	using mapped_type = V;
+
+	template <bool IsConst>
+	class iter_t;
+	using iterator = iter_t<false>;
+	using const_iterator = iter_t<true>;
+
+	static constexpr size_type fanout = Fanout;
+
+	fixed_btree_map() = default;
+	explicit fixed_btree_map(Compare comp) : m_comp(std::move(comp)) {}
+
+	iterator begin() noexcept { return make_iterator<false>(m_first, 0); }
+	iterator end() noexcept { return iterator(this, npos, 0); }
+	const_iterator begin() const noexcept { return make_iterator<true>(m_first, 0); }
+	const_iterator end() const noexcept { return const_iterator(this, npos, 0); }
+	const_iterator cbegin() const noexcept { return begin(); }
+	const_iterator cend() const noexcept { return end(); }
+
+	bool empty() const noexcept { return m_size == 0; }
+	size_type size() const noexcept { return m_size; }
+	///
+	/// \brief Leaf nodes in use, out of Nodes
+	///
+	size_type leaf_count() const noexcept { return m_leaves.size(); }
+	size_type height() const noexcept { return m_leaves.empty() ? 0 : m_height + 1; }
+
+	///
+	/// \brief First entry whose key is not less than key
+	///
+	template <typename U>
+	iterator lower_bound(U const& key) noexcept;
+	template <typename U>
+	const_iterator lower_bound(U const& key) const noexcept;
+	template <typename U>
+	V* find(U const& key) noexcept;
+	template <typename U>
+	V const* find(U const& key) const noexcept;
+	template <typename U>
+	bool contains(U const& key) const noexcept {
+		return find(key) != nullptr;
+	}
+	V& operator[](K const& key) { return *try_emplace(key).first; }
+
+	void clear() noexcept;
+	///
+	/// \brief Insert value at key if not present
+	/// \returns Pointer to the mapped value and whether insertion took place
+	///
+	template <typename... Args>
+	std::pair<V*, bool> try_emplace(K const& key, Args&&... args);
+	std::pair<V*, bool> insert(K const& key, V const& value) { return try_emplace(key, value); }
+	std::pair<V*, bool> insert(K const& key, V&& value) { return try_emplace(key, std::move(value)); }
+	template <typename U>
+	std::pair<V*, bool> insert_or_assign(K const& key, U&& value);
+	template <typename U>
+	bool erase(U const& key);
+	///
+	/// \brief Replace the contents with a range of key-value pairs sorted by key (with unique keys)
+	/// Leaves are packed full and inner levels built bottom-up, without any splits
+	///
+	template <typename InputIt>
+	void assign_sorted(InputIt first, InputIt last);
+
+  private:
+	static constexpr index_t npos = static_cast<index_t>(-1);
+	// enough for Nodes < 2^32 at the minimum branching factor
+	static constexpr size_type max_height_v = 40;
+
+	// key arrays start on a cache line so a node search touches as few lines as possible
+	struct leaf_t {
+		alignas(64) fixed_vector<K, Fanout> keys;
+		fixed_vector<V, Fanout> values;
+		index_t next = npos;
+	};
+	struct inner_t {
+		// keys[i] separates children[i] (less) from children[i + 1] (not less)
+		alignas(64) fixed_vector<K, Fanout> keys;
+		fixed_vector<index_t, Fanout + 1> children;
+	};
+	struct step_t {
+		index_t inner;
+		index_t slot;
+	};
+
+	template <typename U>
+	size_type child_slot(inner_t const& inner, U const& key) const noexcept {
+		return detail::sorted_partition_point<Fanout>(inner.keys.data(), inner.keys.size(), [&](K const& k) { return !m_comp(key, k); });
+	}
+	template <typename U>
+	size_type leaf_slot(leaf_t const& leaf, U const& key) const noexcept {
+		return detail::sorted_partition_point<Fanout>(leaf.keys.data(), leaf.keys.size(), [&](K const& k) { return m_comp(k, key); });
+	}
+	template <typename U>
+	index_t find_leaf(U const& key) const noexcept;
+	template <typename U>
+	std::pair<index_t, size_type> find_entry(U const& key) const noexcept;
+	template <bool IsConst>
+	iter_t<IsConst> make_iterator(index_t leaf, size_type pos) const noexcept;
+	K const& min_key(index_t node, size_type level) const noexcept;
+	index_t new_leaf();
+	index_t new_inner();
+	void insert_separator(fixed_vector<step_t, max_height_v>& path, K separator, index_t right);
+
+	fixed_vector<leaf_t, Nodes> m_leaves;
+	fixed_vector<inner_t, inner_nodes_v> m_inners;
+	index_t m_root = npos;
+	index_t m_first = npos;
+	// number of inner levels above the leaves
+	size_type m_height = 0;
+	size_type m_size = 0;
+	Compare m_comp;
+
+	template <bool IsConst>
+	friend class iter_t;
+};
+
+// impl
+
+template <typename K, typename V, std::size_t Nodes, std::size_t Fanout, typename Compare>
+template <bool IsConst>
+class fixed_btree_map<K, V, Nodes, Fanout, Compare>::iter_t {
+	using map_t = std::conditional_t<IsConst, fixed_btree_map const, fixed_btree_map>;
+	using mapped_ref = std::conditional_t<IsConst, V const&, V&>;
+
+  public:
+	using iterator_category = std::forward_iterator_tag;
+	using value_type = std::pair<K, V>;
+	using difference_type = std::ptrdiff_t;
+	using reference = std::pair<K const&, mapped_ref>;
+	using pointer = void;
+
+	iter_t() = default;
+	// Implicit conversion to const iter_t
+	operator iter_t<true>() const noexcept { return iter_t<true>(m_map, m_leaf, m_pos); }
+
+	K const& key() const noexcept { return m_map->m_leaves[m_leaf].keys[m_pos]; }
+	mapped_ref value() const noexcept { return m_map->m_leaves[m_leaf].values[m_pos]; }
+	reference operator*() const noexcept { return reference(key(), value()); }
+
+	iter_t& operator++() noexcept {
+		*this = m_map->template make_iterator<IsConst>(m_leaf, m_pos + 1);
+		return *this;
+	}
+	iter_t operator++(int) noexcept {
+		auto ret = *this;
+		++(*this);
+		return ret;
+	}
+
+	friend bool operator==(iter_t const& lhs, iter_t const& rhs) noexcept { return lhs.m_leaf == rhs.m_leaf && lhs.m_pos == rhs.m_pos; }
+	friend bool operator!=(iter_t const& lhs, iter_t const& rhs) noexcept { return !(lhs == rhs); }
+
+  private:
+	iter_t(map_t* map, index_t leaf, size_type pos) noexcept : m_map(map), m_leaf(leaf), m_pos(pos) {}
+
+	map_t* m_map{};
+	index_t m_leaf = npos;
+	size_type m_pos{};
+
+	friend class fixed_btree_map;
+};
+
+template <typename K, typename V, std::size_t Nodes, std::size_t Fanout, typename Compare>
+template <typename U>
+typename fixed_btree_map<K, V, Nodes, Fanout, Compare>::iterator fixed_btree_map<K, V, Nodes, Fanout, Compare>::lower_bound(U const& key) noexcept {
+	const_iterator const it = std::as_const(*this).lower_bound(key);
+	return iterator(this, it.m_leaf, it.m_pos);
+}
+template <typename K, typename V, std::size_t Nodes, std::size_t Fanout, typename Compare>
+template <typename U>
+typename fixed_btree_map<K, V, Nodes, Fanout, Compare>::const_iterator fixed_btree_map<K, V, Nodes, Fanout, Compare>::lower_bound(U const& key) const noexcept {
+	index_t const leaf = find_leaf(key);
+	if (leaf == npos) { return end(); }
+	return make_iterator<true>(leaf, leaf_slot(m_leaves[leaf], key));
+}
+template <typename K, typename V, std::size_t Nodes, std::size_t Fanout, typename Compare>
+template <typename U>
+V* fixed_btree_map<K, V, Nodes, Fanout, Compare>::find(U const& key) noexcept {
+	return const_cast<V*>(std::as_const(*this).find(key));
+}
+template <typename K, typename V, std::size_t Nodes, std::size_t Fanout, typename Compare>
+template <typename U>
+V const* fixed_btree_map<K, V, Nodes, Fanout, Compare>::find(U const& key) const noexcept {
+	auto const [leaf, pos] = find_entry(key);
+	return leaf == npos ? nullptr : &m_leaves[leaf].values[pos];
+}
+template <typename K, typename V, std::size_t Nodes, std::size_t Fanout, typename Compare>
+void fixed_btree_map<K, V, Nodes, Fanout, Compare>::clear() noexcept {
+	m_leaves.clear();
+	m_inners.clear();
+	m_root = m_first = npos;
+	m_height = 0;
+	m_size = 0;
+}
+template <typename K, typename V, std::size_t Nodes, std::size_t Fanout, typename Compare>
+template <typename... Args>
+std::pair<V*, bool> fixed_btree_map<K, V, Nodes, Fanout, Compare>::try_emplace(K const& key, Args&&... args) {
+	if (m_root == npos) { m_root = m_first = new_leaf(); }
+	fixed_vector<step_t, max_height_v> path;
+	index_t node = m_root;
+	for (size_type level = m_height; level > 0; --level) {
+		auto const slot = static_cast<index_t>(child_slot(m_inners[node], key));
+		path.push_back({node, slot});
+		node = m_inners[node].children[slot];
+	}
+	size_type pos = leaf_slot(m_leaves[node], key);
+	{
+		leaf_t& leaf = m_leaves[node];
+		if (pos < leaf.keys.size() && !m_comp(key, leaf.keys[pos])) { return {&leaf.values[pos], false}; }
+	}
+	if (!m_leaves[node].keys.has_space()) {
+		index_t const right = new_leaf();
+		leaf_t& leaf = m_leaves[node];
+		leaf_t& sibling = m_leaves[right];
+		// appending past the last leaf (ascending inserts) leaves the full leaf packed
+		size_type const mid = leaf.next == npos && pos == Fanout ? Fanout : Fanout / 2;
+		for (size_type i = mid; i < Fanout; ++i) {
+			sibling.keys.push_back(std::move(leaf.keys[i]));
+			sibling.values.push_back(std::move(leaf.values[i]));
+		}
+		leaf.keys.erase(leaf.keys.begin() + static_cast<std::ptrdiff_t>(mid), leaf.keys.end());
+		leaf.values.erase(leaf.values.begin() + static_cast<std::ptrdiff_t>(mid), leaf.values.end());
+		sibling.next = leaf.next;
+		leaf.next = right;
+		insert_separator(path, sibling.keys.empty() ? key : sibling.keys.front(), right);
+		// a key landing exactly at the split point stays left, below the separator
+		if (pos > mid || mid == Fanout) {
+			node = right;
+			pos -= mid;
+		}
+	}
+	leaf_t& leaf = m_leaves[node];
+	leaf.keys.insert(leaf.keys.begin() + static_cast<std::ptrdiff_t>(pos), key);
+	leaf.values.emplace(leaf.values.begin() + static_cast<std::ptrdiff_t>(pos), std::forward<Args>(args)...);
+	++m_size;
+	return {&leaf.values[pos], true};
+}
+template <typename K, typename V, std::size_t Nodes, std::size_t Fanout, typename Compare>
+template <typename U>
+std::pair<V*, bool> fixed_btree_map<K, V, Nodes, Fanout, Compare>::insert_or_assign(K const& key, U&& value) {
+	auto ret = try_emplace(key, std::forward<U>(value));
+	if (!ret.second) { *ret.first = std::forward<U>(value); }
+	return ret;
+}
+template <typename K, typename V, std::size_t Nodes, std::size_t Fanout, typename Compare>
+template <typename U>
+bool fixed_btree_map<K, V, Nodes, Fanout, Compare>::erase(U const& key) {
+	auto const [node, pos] = find_entry(key);
+	if (node == npos) { return false; }
+	leaf_t& leaf = m_leaves[node];
+	leaf.keys.erase(leaf.keys.begin() + static_cast<std::ptrdiff_t>(pos));
+	leaf.values.erase(leaf.values.begin() + static_cast<std::ptrdiff_t>(pos));
+	--m_size;
+	return true;
+}
+template <typename K, typename V, std::size_t Nodes, std::size_t Fanout, typename Compare>
+template <typename InputIt>
+void fixed_btree_map<K, V, Nodes, Fanout, Compare>::assign_sorted(InputIt first, InputIt last) {
+	clear();
+	for (; first != last; ++first) {
+		auto&& [key, value] = *first;
+		assert(m_leaves.empty() || m_comp(m_leaves.back().keys.back(), key));
+		if (m_leaves.empty() || !m_leaves.back().keys.has_space()) {
+			index_t const leaf = new_leaf();
+			if (leaf > 0) { m_leaves[leaf - 1].next = leaf; }
+		}
+		leaf_t& leaf = m_leaves.back();
+		leaf.keys.push_back(key);
+		leaf.values.push_back(value);
+		++m_size;
+	}
+	if (m_leaves.empty()) { return; }
+	m_first = 0;
+	// rebalance the last two leaves so none is underfull
+	if (m_leaves.size() > 1 && m_leaves.back().keys.size() < Fanout / 2) {
+		leaf_t& prev = m_leaves[m_leaves.size() - 2];
+		leaf_t& tail = m_leaves.back();
+		auto const move = static_cast<std::ptrdiff_t>(Fanout / 2 - tail.keys.size());
+		tail.keys.insert(tail.keys.begin(), std::make_move_iterator(prev.keys.end() - move), std::make_move_iterator(prev.keys.end()));
+		tail.values.insert(tail.values.begin(), std::make_move_iterator(prev.values.end() - move), std::make_move_iterator(prev.values.end()));
+		prev.keys.erase(prev.keys.end() - move, prev.keys.end());
+		prev.values.erase(prev.values.end() - move, prev.values.end());
+	}
+	// each level occupies a contiguous index range of its pool: group it evenly into parents
+	size_type level_first = 0;
+	size_type level_count = m_leaves.size();
+	while (level_count > 1) {
+		size_type const parents = (level_count + Fanout) / (Fanout + 1);
+		size_type const next_first = m_inners.size();
+		size_type child = level_first;
+		for (size_type p = 0; p < parents; ++p) {
+			size_type const count = level_count / parents + (p < level_count % parents ? 1 : 0);
+			inner_t& inner = m_inners[new_inner()];
+			for (size_type c = 0; c < count; ++c, ++child) {
+				if (c > 0) { inner.keys.push_back(min_key(static_cast<index_t>(child), m_height)); }
+				inner.children.push_back(static_cast<index_t>(child));
+			}
+		}
+		level_first = next_first;
+		level_count = parents;
+		++m_height;
+	}
+	m_root = static_cast<index_t>(level_first);
+}
+template <typename K, typename V, std::size_t Nodes, std::size_t Fanout, typename Compare>
+template <typename U>
+typename fixed_btree_map<K, V, Nodes, Fanout, Compare>::index_t fixed_btree_map<K, V, Nodes, Fanout, Compare>::find_leaf(U const& key) const noexcept {
+	index_t node = m_root;
+	if (node == npos) { return npos; }
+	for (size_type level = m_height; level > 0; --level) {
+		inner_t const& inner = m_inners[node];
+		node = inner.children[child_slot(inner, key)];
+	}
+	return node;
+}
+template <typename K, typename V, std::size_t Nodes, std::size_t Fanout, typename Compare>
+template <typename U>
+std::pair<typename fixed_btree_map<K, V, Nodes, Fanout, Compare>::index_t, std::size_t> fixed_btree_map<K, V, Nodes, Fanout, Compare>::find_entry(U const& key) const noexcept {
+	index_t const node = find_leaf(key);
+	if (node == npos) { return {npos, 0}; }
+	leaf_t const& leaf = m_leaves[node];
+	size_type const pos = leaf_slot(leaf, key);
+	if (pos == leaf.keys.size() || m_comp(key, leaf.keys[pos])) { return {npos, 0}; }
+	return {node, pos};
+}
+template <typename K, typename V, std::size_t Nodes, std::size_t Fanout, typename Compare>
+template <bool IsConst>
+typename fixed_btree_map<K, V, Nodes, Fanout, Compare>::template iter_t<IsConst> fixed_btree_map<K, V, Nodes, Fanout, Compare>::make_iterator(index_t leaf, size_type pos) const noexcept {
+	// skip past the end of a leaf, and over leaves emptied by erase
+	while (leaf != npos && pos >= m_leaves[leaf].keys.size()) {
+		leaf = m_leaves[leaf].next;
+		pos = 0;
+	}
+	using map_t = std::conditional_t<IsConst, fixed_btree_map const, fixed_btree_map>;
+	return iter_t<IsConst>(const_cast<map_t*>(this), leaf, pos);
+}
+template <typename K, typename V, std::size_t Nodes, std::size_t Fanout, typename Compare>
+K const& fixed_btree_map<K, V, Nodes, Fanout, Compare>::min_key(index_t node, size_type level) const noexcept {
+	for (; level > 0; --level) { node = m_inners[node].children.front(); }
+	return m_leaves[node].keys.front();
+}
+template <typename K, typename V, std::size_t Nodes, std::size_t Fanout, typename Compare>
+typename fixed_btree_map<K, V, Nodes, Fanout, Compare>::index_t fixed_btree_map<K, V, Nodes, Fanout, Compare>::new_leaf() {
+	assert(m_leaves.has_space());
+	m_leaves.emplace_back();
+	return static_cast<index_t>(m_leaves.size() - 1);
+}
+template <typename K, typename V, std::size_t Nodes, std::size_t Fanout, typename Compare>
+typename fixed_btree_map<K, V, Nodes, Fanout, Compare>::index_t fixed_btree_map<K, V, Nodes, Fanout, Compare>::new_inner() {
+	assert(m_inners.has_space());
+	m_inners.emplace_back();
+	return static_cast<index_t>(m_inners.size() - 1);
+}
+template <typename K, typename V, std::size_t Nodes, std::size_t Fanout, typename Compare>
+void fixed_btree_map<K, V, Nodes, Fanout, Compare>::insert_separator(fixed_vector<step_t, max_height_v>& path, K separator, index_t right) {
+	while (!path.empty()) {
+		step_t const step = path.back();
+		path.pop_back();
+		inner_t& inner = m_inners[step.inner];
+		if (inner.keys.has_space()) {
+			inner.keys.insert(inner.keys.begin() + step.slot, std::move(separator));
+			inner.children.insert(inner.children.begin() + step.slot + 1, right);
+			return;
+		}
+		// split around the middle key, which moves up; then insert into the half that owns slot
+		index_t const split = new_inner();
+		inner_t& full = m_inners[step.inner];
+		inner_t& sibling = m_inners[split];
+		size_type const mid = Fanout / 2;
+		K promoted = std::move(full.keys[mid]);
+		for (size_type i = mid + 1; i < Fanout; ++i) { sibling.keys.push_back(std::move(full.keys[i])); }
+		for (size_type i = mid + 1; i <= Fanout; ++i) { sibling.children.push_back(full.children[i]); }
+		full.keys.erase(full.keys.begin() + mid, full.keys.end());
+		full.children.erase(full.children.begin() + mid + 1, full.children.end());
+		inner_t& target = step.slot <= mid ? full : sibling;
+		size_type const slot = step.slot <= mid ? step.slot : step.slot - mid - 1;
+		target.keys.insert(target.keys.begin() + static_cast<std::ptrdiff_t>(slot), std::move(separator));
+		target.children.insert(target.children.begin() + static_cast<std::ptrdiff_t>(slot + 1), right);
+		separator = std::move(promoted);
+		right = split;
+	}
+	// root split: grow a level
+	index_t const root = new_inner();
+	inner_t& inner = m_inners[root];
+	inner.keys.push_back(std::move(separator));
+	inner.children.push_back(m_root);
+	inner.children.push_back(right);
+	m_root = root;
+	++m_height;
+}
+} // namespace kt
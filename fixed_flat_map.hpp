@@ -0,0 +1,295 @@
+// KT header-only library
+// Requirements: C++17
+
+#pragma once
+#include "sorted_fixed_vector.hpp"
+
+namespace kt {
+///
+/// \brief Sorted associative container with unique keys on inline storage
+/// Keys and values are kept in separate arrays so key searches stay dense;
+/// lookups count linearly for small N and use a branchless binary search otherwise
+///
+template <typename K, typename V, std::size_t N, typename Compare = std::less<>>
+class fixed_flat_map {
+  public:
+	using size_type = std::size_t;
+	using key_type = K;
+	using mapped_type = V;
+
+	static constexpr size_type npos = static_cast<size_type>(-1);
+	static constexpr size_type max_size() noexcept { return N; }
+
+	fixed_flat_map() = default;
+	explicit fixed_flat_map(Compare comp) : m_comp(std::move(comp)) {}
+
+	bool empty() const noexcept { return m_keys.empty(); }
+	size_type size() const noexcept { return m_keys.size(); }
+	constexpr size_type capacity() const noexcept { return N; }
+	bool has_space() const noexcept { return m_keys.has_space(); }
+
+	///
+	/// \brief Sorted keys
+	///
+	fixed_vector<K, N> const& keys() const noexcept { return m_keys; }
+	///
+	/// \brief Values, in key order
+	///
+	fixed_vector<V, N>& values() noexcept { return m_values; }
+	fixed_vector<V, N> const& values() const noexcept { return m_values; }
+
+	///
+	/// \brief Index of key, or npos
+	///
+	template <typename U>
+	size_type index_of(U const& key) const noexcept;
+	template <typename U>
+	V* find(U const& key) noexcept;
+	template <typename U>
+	V const* find(U const& key) const noexcept;
+	template <typename U>
+	bool contains(U const& key) const noexcept {
+		return index_of(key) != npos;
+	}
+	V& operator[](K const& key) { return *try_emplace(key).first; }
+
+	void clear() noexcept;
+	///
+	/// \brief Insert value at key if not present
+	/// \returns Pointer to the mapped value and whether insertion took place
+	///
+	template <typename... Args>
+	std::pair<V*, bool> try_emplace(K const& key, Args&&... args);
+	std::pair<V*, bool> insert(K const& key, V const& value) { return try_emplace(key, value); }
+	std::pair<V*, bool> insert(K const& key, V&& value) { return try_emplace(key, std::move(value)); }
+	template <typename U>
+	std::pair<V*, bool> insert_or_assign(K const& key, U&& value);
+	///
+	/// \brief Insert a range of key-value pairs sorted by key (with unique keys) in a single backward merge
+	/// Keys already present are skipped; K and V must be default constructible
+	///
+	template <typename BidirIt>
+	void insert_sorted_range(BidirIt first, BidirIt last);
+	template <typename U>
+	bool erase(U const& key);
+	void erase_at(size_type index);
+
+  private:
+	template <typename U>
+	size_type lower_bound(U const& key) const noexcept;
+
+	fixed_vector<K, N> m_keys;
+	fixed_vector<V, N> m_values;
+	Compare m_comp;
+};
+
+///
+/// \brief Sorted set of unique keys on inline storage
+///
+template <typename K, std::size_t N, typename Compare = std::less<>>
+class fixed_flat_set {
+  public:
+	using size_type = std::size_t;
+	using key_type = K;
+	using value_type = K;
+	using const_iterator = K const*;
+	using iterator = const_iterator;
+
+	static constexpr size_type npos = static_cast<size_type>(-1);
+	static constexpr size_type max_size() noexcept { return N; }
+
+	fixed_flat_set() = default;
+	explicit fixed_flat_set(Compare comp) : m_comp(std::move(comp)) {}
+
+	bool empty() const noexcept { return m_keys.empty(); }
+	size_type size() const noexcept { return m_keys.size(); }
+	constexpr size_type capacity() const noexcept { return N; }
+	bool has_space() const noexcept { return m_keys.has_space(); }
+
+	const_iterator begin() const noexcept { return m_keys.data(); }
+	const_iterator end() const noexcept { return begin() + size(); }
+	fixed_vector<K, N> const& keys() const noexcept { return m_keys; }
+
+	template <typename U>
+	size_type index_of(U const& key) const noexcept;
+	template <typename U>
+	bool contains(U const& key) const noexcept {
+		return index_of(key) != npos;
+	}
+
+	void clear() noexcept { m_keys.clear(); }
+	///
+	/// \returns Whether key was inserted
+	///
+	bool insert(K const& key);
+	///
+	/// \brief Insert a range of unique keys sorted by Compare in a single backward merge
+	/// Keys already present are skipped; K must be default constructible
+	///
+	template <typename BidirIt>
+	void insert_sorted_range(BidirIt first, BidirIt last);
+	template <typename U>
+	bool erase(U const& key);
+
+  private:
+	template <typename U>
+	size_type lower_bound(U const& key) const noexcept {
+		return detail::sorted_partition_point<N>(m_keys.data(), m_keys.size(), [&](K const& k) { return m_comp(k, key); });
+	}
+
+	fixed_vector<K, N> m_keys;
+	Compare m_comp;
+};
+
+// impl
+
+template <typename K, typename V, std::size_t N, typename Compare>
+template <typename U>
+typename fixed_flat_map<K, V, N, Compare>::size_type fixed_flat_map<K, V, N, Compare>::lower_bound(U const& key) const noexcept {
+	return detail::sorted_partition_point<N>(m_keys.data(), m_keys.size(), [&](K const& k) { return m_comp(k, key); });
+}
+template <typename K, typename V, std::size_t N, typename Compare>
+template <typename U>
+typename fixed_flat_map<K, V, N, Compare>::size_type fixed_flat_map<K, V, N, Compare>::index_of(U const& key) const noexcept {
+	size_type const ret = lower_bound(key);
+	return ret < size() && !m_comp(key, m_keys[ret]) ? ret : npos;
+}
+template <typename K, typename V, std::size_t N, typename Compare>
+template <typename U>
+V* fixed_flat_map<K, V, N, Compare>::find(U const& key) noexcept {
+	size_type const idx = index_of(key);
+	return idx == npos ? nullptr : &m_values[idx];
+}
+template <typename K, typename V, std::size_t N, typename Compare>
+template <typename U>
+V const* fixed_flat_map<K, V, N, Compare>::find(U const& key) const noexcept {
+	size_type const idx = index_of(key);
+	return idx == npos ? nullptr : &m_values[idx];
+}
+template <typename K, typename V, std::size_t N, typename Compare>
+void fixed_flat_map<K, V, N, Compare>::clear() noexcept {
+	m_keys.clear();
+	m_values.clear();
+}
+template <typename K, typename V, std::size_t N, typename Compare>
+template <typename... Args>
+std::pair<V*, bool> fixed_flat_map<K, V, N, Compare>::try_emplace(K const& key, Args&&... args) {
+	size_type const idx = lower_bound(key);
+	if (idx < size() && !m_comp(key, m_keys[idx])) { return {&m_values[idx], false}; }
+	assert(has_space());
+	auto const pos = static_cast<std::ptrdiff_t>(idx);
+	m_keys.insert(m_keys.cbegin() + pos, key);
+	m_values.emplace(m_values.cbegin() + pos, std::forward<Args>(args)...);
+	return {&m_values[idx], true};
+}
+template <typename K, typename V, std::size_t N, typename Compare>
+template <typename U>
+std::pair<V*, bool> fixed_flat_map<K, V, N, Compare>::insert_or_assign(K const& key, U&& value) {
+	auto ret = try_emplace(key, std::forward<U>(value));
+	if (!ret.second) { *ret.first = std::forward<U>(value); }
+	return ret;
+}
+template <typename K, typename V, std::size_t N, typename Compare>
+template <typename BidirIt>
+void fixed_flat_map<K, V, N, Compare>::insert_sorted_range(BidirIt first, BidirIt last) {
+	size_type const prev = size();
+	// count keys not yet present
+	size_type added = 0;
+	size_type i = 0;
+	for (BidirIt it = first; it != last; ++it) {
+		auto const& key = it->first;
+		while (i < prev && m_comp(m_keys[i], key)) { ++i; }
+		if (i == prev || m_comp(key, m_keys[i])) { ++added; }
+	}
+	if (added == 0) { return; }
+	assert(prev + added <= N);
+	m_keys.resize(prev + added);
+	m_values.resize(prev + added);
+	K* keys = m_keys.data();
+	V* values = m_values.data();
+	// merge from the back so no element moves more than once
+	size_type w = prev + added;
+	i = prev;
+	while (last != first && w > i) {
+		BidirIt const it = std::prev(last);
+		if (i > 0 && !m_comp(keys[i - 1], it->first)) {
+			bool const dup = !m_comp(it->first, keys[i - 1]);
+			--w;
+			--i;
+			keys[w] = std::move(keys[i]);
+			values[w] = std::move(values[i]);
+			if (dup) { last = it; }
+		} else {
+			--w;
+			keys[w] = it->first;
+			values[w] = it->second;
+			last = it;
+		}
+	}
+}
+template <typename K, typename V, std::size_t N, typename Compare>
+template <typename U>
+bool fixed_flat_map<K, V, N, Compare>::erase(U const& key) {
+	size_type const idx = index_of(key);
+	if (idx == npos) { return false; }
+	erase_at(idx);
+	return true;
+}
+template <typename K, typename V, std::size_t N, typename Compare>
+void fixed_flat_map<K, V, N, Compare>::erase_at(size_type index) {
+	assert(index < size());
+	auto const pos = static_cast<std::ptrdiff_t>(index);
+	m_keys.erase(m_keys.cbegin() + pos);
+	m_values.erase(m_values.cbegin() + pos);
+}
+
+template <typename K, std::size_t N, typename Compare>
+template <typename U>
+typename fixed_flat_set<K, N, Compare>::size_type fixed_flat_set<K, N, Compare>::index_of(U const& key) const noexcept {
+	size_type const ret = lower_bound(key);
+	return ret < size() && !m_comp(key, m_keys[ret]) ? ret : npos;
+}
+template <typename K, std::size_t N, typename Compare>
+bool fixed_flat_set<K, N, Compare>::insert(K const& key) {
+	size_type const idx = lower_bound(key);
+	if (idx < size() && !m_comp(key, m_keys[idx])) { return false; }
+	m_keys.insert(m_keys.cbegin() + static_cast<std::ptrdiff_t>(idx), key);
+	return true;
+}
+template <typename K, std::size_t N, typename Compare>
+template <typename BidirIt>
+void fixed_flat_set<K, N, Compare>::insert_sorted_range(BidirIt first, BidirIt last) {
+	size_type const prev = size();
+	size_type added = 0;
+	size_type i = 0;
+	for (BidirIt it = first; it != last; ++it) {
+		while (i < prev && m_comp(m_keys[i], *it)) { ++i; }
+		if (i == prev || m_comp(*it, m_keys[i])) { ++added; }
+	}
+	if (added == 0) { return; }
+	assert(prev + added <= N);
+	m_keys.resize(prev + added);
+	K* keys = m_keys.data();
+	size_type w = prev + added;
+	i = prev;
+	while (last != first && w > i) {
+		BidirIt const it = std::prev(last);
+		if (i > 0 && !m_comp(keys[i - 1], *it)) {
+			bool const dup = !m_comp(*it, keys[i - 1]);
+			keys[--w] = std::move(keys[--i]);
+			if (dup) { last = it; }
+		} else {
+			keys[--w] = *it;
+			last = it;
+		}
+	}
+}
+template <typename K, std::size_t N, typename Compare>
+template <typename U>
+bool fixed_flat_set<K, N, Compare>::erase(U const& key) {
+	size_type const idx = index_of(key);
+	if (idx == npos) { return false; }
+	m_keys.erase(m_keys.cbegin() + static_cast<std::ptrdiff_t>(idx));
+	return true;
+}
+} // namespace kt
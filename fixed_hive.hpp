@@ -0,0 +1,164 @@
+// KT header-only library
+// Requirements: C++17
+
+#pragma once
+#include "fixed_bitvector.hpp"
+#include "fixed_vector.hpp"
+
+namespace kt {
+///
+/// \brief Unordered container of up to N elements that never move once inserted
+/// Erased slots are recycled by later inserts; a bitmask skip-field makes iteration
+/// cost one word scan per 64 slots plus one step per live element, at any occupancy.
+/// Not copyable or movable, since element addresses are stable for the container's lifetime.
+///
+template <typename T, std::size_t N>
+class fixed_hive {
+	static_assert(N <= std::size_t{0xffffffff}, "N must fit in 32 bits");
+
+  public:
+	using size_type = std::size_t;
+	using value_type = T;
+
+	template <bool IsConst>
+	class iter_t;
+	using iterator = iter_t<false>;
+	using const_iterator = iter_t<true>;
+
+	static constexpr size_type max_size() noexcept { return N; }
+
+	fixed_hive() noexcept { m_live.resize(N); }
+	fixed_hive(fixed_hive&&) = delete;
+	fixed_hive& operator=(fixed_hive&&) = delete;
+	~fixed_hive() noexcept { clear(); }
+
+	iterator begin() noexcept { return iterator(this, m_live.find_first()); }
+	iterator end() noexcept { return iterator(this, m_live.npos); }
+	const_iterator begin() const noexcept { return const_iterator(this, m_live.find_first()); }
+	const_iterator end() const noexcept { return const_iterator(this, m_live.npos); }
+	const_iterator cbegin() const noexcept { return begin(); }
+	const_iterator cend() const noexcept { return end(); }
+
+	bool empty() const noexcept { return m_size == 0; }
+	size_type size() const noexcept { return m_size; }
+	constexpr size_type capacity() const noexcept { return N; }
+	bool has_space() const noexcept { return m_size < N; }
+
+	template <typename... Args>
+	iterator emplace(Args&&... args);
+	iterator insert(T const& t) { return emplace(t); }
+	iterator insert(T&& t) { return emplace(std::move(t)); }
+	///
+	/// \returns Iterator to the next live element
+	///
+	iterator erase(const_iterator pos);
+	///
+	/// \brief Erase the element at ptr, which must point into this hive
+	///
+	void erase(T const* ptr) { erase(get_iterator(ptr)); }
+	const_iterator get_iterator(T const* ptr) const noexcept;
+	void clear() noexcept;
+
+  private:
+	using storage_t = std::array<std::aligned_storage_t<sizeof(T), alignof(T)>, N>;
+
+	T* slot(size_type index) noexcept { return std::launder(reinterpret_cast<T*>(&m_storage[index])); }
+	T const* slot(size_type index) const noexcept { return std::launder(reinterpret_cast<T const*>(&m_storage[index])); }
+
+	storage_t m_storage;
+	fixed_bitvector<N> m_live;
+	fixed_vector<std::uint32_t, N> m_free;
+	size_type m_high = 0;
+	size_type m_size = 0;
+
+	template <bool IsConst>
+	friend class iter_t;
+};
+
+// impl
+
+template <typename T, std::size_t N>
+template <bool IsConst>
+class fixed_hive<T, N>::iter_t {
+	using hive_t = std::conditional_t<IsConst, fixed_hive const, fixed_hive>;
+
+  public:
+	using iterator_category = std::forward_iterator_tag;
+	using value_type = T;
+	using difference_type = std::ptrdiff_t;
+	using pointer = std::conditional_t<IsConst, T const*, T*>;
+	using reference = std::conditional_t<IsConst, T const&, T&>;
+
+	iter_t() = default;
+	// Implicit conversion to const iter_t
+	operator iter_t<true>() const noexcept { return iter_t<true>(m_hive, m_index); }
+
+	reference operator*() const noexcept { return *m_hive->slot(m_index); }
+	pointer operator->() const noexcept { return m_hive->slot(m_index); }
+
+	iter_t& operator++() noexcept {
+		m_index = m_hive->m_live.find_next(m_index);
+		return *this;
+	}
+	iter_t operator++(int) noexcept {
+		auto ret = *this;
+		++(*this);
+		return ret;
+	}
+
+	friend bool operator==(iter_t const& lhs, iter_t const& rhs) noexcept { return lhs.m_hive == rhs.m_hive && lhs.m_index == rhs.m_index; }
+	friend bool operator!=(iter_t const& lhs, iter_t const& rhs) noexcept { return !(lhs == rhs); }
+
+  private:
+	iter_t(hive_t* hive, size_type index) noexcept : m_hive(hive), m_index(index) {}
+
+	hive_t* m_hive{};
+	size_type m_index{};
+
+	friend class fixed_hive<T, N>;
+};
+
+template <typename T, std::size_t N>
+template <typename... Args>
+typename fixed_hive<T, N>::iterator fixed_hive<T, N>::emplace(Args&&... args) {
+	assert(has_space());
+	size_type index = m_high;
+	if (!m_free.empty()) {
+		index = m_free.back();
+		m_free.pop_back();
+	} else {
+		++m_high;
+	}
+	new (&m_storage[index]) T(std::forward<Args>(args)...);
+	m_live.set(index);
+	++m_size;
+	return iterator(this, index);
+}
+template <typename T, std::size_t N>
+typename fixed_hive<T, N>::iterator fixed_hive<T, N>::erase(const_iterator pos) {
+	size_type const index = pos.m_index;
+	assert(index < N && m_live.test(index));
+	slot(index)->~T();
+	m_live.reset(index);
+	m_free.push_back(static_cast<std::uint32_t>(index));
+	--m_size;
+	return iterator(this, m_live.find_next(index));
+}
+template <typename T, std::size_t N>
+typename fixed_hive<T, N>::const_iterator fixed_hive<T, N>::get_iterator(T const* ptr) const noexcept {
+	auto const offset = reinterpret_cast<std::uintptr_t>(ptr) - reinterpret_cast<std::uintptr_t>(m_storage.data());
+	auto const index = static_cast<size_type>(offset / sizeof(m_storage[0]));
+	assert(index < N && m_live.test(index));
+	return const_iterator(this, index);
+}
+template <typename T, std::size_t N>
+void fixed_hive<T, N>::clear() noexcept {
+	if constexpr (!std::is_trivially_destructible_v<T>) {
+		for (T& t : *this) { t.~T(); }
+	}
+	m_live.reset();
+	m_free.clear();
+	m_high = 0;
+	m_size = 0;
+}
+} // namespace kt
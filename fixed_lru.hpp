@@ -0,0 +1,334 @@
+// KT header-only library
+// Requirements: C++17
+
+#pragma once
+#include <tuple>
+#include "fixed_bitvector.hpp"
+#include "fixed_vector.hpp"
+
+namespace kt {
+enum class lru_policy {
+	// exact recency order: every hit relinks the entry at the front
+	lru,
+	// second-chance approximation: a hit only sets a bit, eviction sweeps a hand over the slots
+	clock,
+};
+
+///
+/// \brief Cache of up to N key-value pairs on inline storage, evicting the least recently used entry when full
+/// Entries never move once inserted: an open-addressing index of slot numbers (linear probing, backward-shift
+/// erase) finds them, and recency is tracked by 16 or 32 bit slot links (or reference bits in clock mode).
+/// Lookup, insertion and eviction are O(1); find() counts as a use, peek() and contains() do not.
+///
+template <typename K, typename V, std::size_t N, lru_policy Policy = lru_policy::lru, typename Hash = std::hash<K>, typename KeyEqual = std::equal_to<K>>
+class fixed_lru {
+	static_assert(N > 0, "N must be positive");
+	using index_t = std::conditional_t<(N < 0xffff), std::uint16_t, std::uint32_t>;
+
+  public:
+	using size_type = std::size_t;
+	using key_type = K;
+	using mapped_type = V;
+	using value_type = std::pair<K const, V>;
+
+	static constexpr size_type index_count = detail::probe_slot_count(N);
+	static constexpr size_type max_size() noexcept { return N; }
+
+	fixed_lru() noexcept { m_index.fill(npos); }
+	fixed_lru(fixed_lru&& rhs) noexcept;
+	fixed_lru(fixed_lru const& rhs);
+	fixed_lru& operator=(fixed_lru&& rhs) noexcept;
+	fixed_lru& operator=(fixed_lru const& rhs);
+	~fixed_lru() noexcept { clear(); }
+
+	bool empty() const noexcept { return m_size == 0; }
+	bool full() const noexcept { return m_size == N; }
+	size_type size() const noexcept { return m_size; }
+	constexpr size_type capacity() const noexcept { return N; }
+
+	///
+	/// \brief Look up key and mark it as most recently used
+	///
+	V* find(K const& key) noexcept;
+	///
+	/// \brief Look up key without affecting eviction order
+	///
+	V const* peek(K const& key) const noexcept;
+	bool contains(K const& key) const noexcept { return find_pos(key, hash(key)) != index_count; }
+	V& operator[](K const& key) { return *try_emplace(key).first; }
+
+	void clear() noexcept;
+	///
+	/// \brief Insert value at key if not present, evicting the least recently used entry if full
+	/// \returns Pointer to the mapped value and whether insertion took place; key is marked as most recently used
+	/// key and args may refer to the evicted entry: when full, the new entry is built first and then moved into the victim's slot
+	///
+	template <typename... Args>
+	std::pair<V*, bool> try_emplace(K const& key, Args&&... args);
+	std::pair<V*, bool> insert(K const& key, V const& value) { return try_emplace(key, value); }
+	std::pair<V*, bool> insert(K const& key, V&& value) { return try_emplace(key, std::move(value)); }
+	template <typename U>
+	std::pair<V*, bool> insert_or_assign(K const& key, U&& value);
+	///
+	/// \returns Whether key was erased
+	///
+	bool erase(K const& key);
+
+  private:
+	using storage_t = std::array<std::aligned_storage_t<sizeof(value_type), alignof(value_type)>, N>;
+	static constexpr index_t npos = static_cast<index_t>(-1);
+	static constexpr size_type mask = index_count - 1;
+
+	struct lru_list {
+		struct link_t {
+			index_t prev;
+			index_t next;
+		};
+
+		// head is the most recently used slot, tail the eviction victim
+		std::array<link_t, N> links;
+		index_t head = npos;
+		index_t tail = npos;
+	};
+	struct clock_ring {
+		clock_ring() noexcept { referenced.resize(N); }
+
+		fixed_bitvector<N> referenced;
+		size_type hand = 0;
+	};
+	using recency_t = std::conditional_t<Policy == lru_policy::clock, clock_ring, lru_list>;
+
+	static std::uint32_t hash(K const& key) noexcept { return static_cast<std::uint32_t>(detail::hash_mix(static_cast<std::uint64_t>(Hash{}(key)))); }
+	static size_type home(std::uint32_t h) noexcept { return static_cast<size_type>(h) & mask; }
+
+	value_type* slot(size_type index) noexcept { return std::launder(reinterpret_cast<value_type*>(&m_slots[index])); }
+	value_type const* slot(size_type index) const noexcept { return std::launder(reinterpret_cast<value_type const*>(&m_slots[index])); }
+	size_type find_pos(K const& key, std::uint32_t h) const noexcept;
+	size_type empty_pos(std::uint32_t h) const noexcept;
+	void remove_pos(size_type hole) noexcept;
+	void link_front(index_t index) noexcept;
+	void unlink(index_t index) noexcept;
+	void touch(index_t index) noexcept;
+	index_t evict() noexcept;
+	template <typename Lru>
+	void clone(Lru&& rhs);
+
+	storage_t m_slots;
+	// slot of each indexed entry, or npos
+	std::array<index_t, index_count> m_index;
+	std::array<std::uint32_t, N> m_hashes;
+	recency_t m_recency;
+	fixed_vector<index_t, N> m_free;
+	// slots at or past m_used have never been constructed
+	size_type m_used = 0;
+	size_type m_size = 0;
+};
+
+// impl
+
+template <typename K, typename V, std::size_t N, lru_policy Policy, typename Hash, typename KeyEqual>
+fixed_lru<K, V, N, Policy, Hash, KeyEqual>::fixed_lru(fixed_lru&& rhs) noexcept {
+	clone(std::move(rhs));
+	rhs.clear();
+}
+template <typename K, typename V, std::size_t N, lru_policy Policy, typename Hash, typename KeyEqual>
+fixed_lru<K, V, N, Policy, Hash, KeyEqual>::fixed_lru(fixed_lru const& rhs) {
+	clone(rhs);
+}
+template <typename K, typename V, std::size_t N, lru_policy Policy, typename Hash, typename KeyEqual>
+fixed_lru<K, V, N, Policy, Hash, KeyEqual>& fixed_lru<K, V, N, Policy, Hash, KeyEqual>::operator=(fixed_lru&& rhs) noexcept {
+	if (&rhs != this) {
+		clear();
+		clone(std::move(rhs));
+		rhs.clear();
+	}
+	return *this;
+}
+template <typename K, typename V, std::size_t N, lru_policy Policy, typename Hash, typename KeyEqual>
+fixed_lru<K, V, N, Policy, Hash, KeyEqual>& fixed_lru<K, V, N, Policy, Hash, KeyEqual>::operator=(fixed_lru const& rhs) {
+	if (&rhs != this) {
+		clear();
+		clone(rhs);
+	}
+	return *this;
+}
+template <typename K, typename V, std::size_t N, lru_policy Policy, typename Hash, typename KeyEqual>
+V* fixed_lru<K, V, N, Policy, Hash, KeyEqual>::find(K const& key) noexcept {
+	size_type const pos = find_pos(key, hash(key));
+	if (pos == index_count) { return nullptr; }
+	touch(m_index[pos]);
+	return &slot(m_index[pos])->second;
+}
+template <typename K, typename V, std::size_t N, lru_policy Policy, typename Hash, typename KeyEqual>
+V const* fixed_lru<K, V, N, Policy, Hash, KeyEqual>::peek(K const& key) const noexcept {
+	size_type const pos = find_pos(key, hash(key));
+	return pos == index_count ? nullptr : &slot(m_index[pos])->second;
+}
+template <typename K, typename V, std::size_t N, lru_policy Policy, typename Hash, typename KeyEqual>
+void fixed_lru<K, V, N, Policy, Hash, KeyEqual>::clear() noexcept {
+	for (index_t& index : m_index) {
+		if (index == npos) { continue; }
+		slot(index)->~value_type();
+		index = npos;
+	}
+	m_recency = recency_t{};
+	m_free.clear();
+	m_used = 0;
+	m_size = 0;
+}
+template <typename K, typename V, std::size_t N, lru_policy Policy, typename Hash, typename KeyEqual>
+template <typename... Args>
+std::pair<V*, bool> fixed_lru<K, V, N, Policy, Hash, KeyEqual>::try_emplace(K const& key, Args&&... args) {
+	std::uint32_t const h = hash(key);
+	if (size_type const pos = find_pos(key, h); pos != index_count) {
+		touch(m_index[pos]);
+		return {&slot(m_index[pos])->second, false};
+	}
+	value_type* ret = nullptr;
+	index_t index = npos;
+	if (full()) {
+		// key and args may refer to the victim: build the entry before destroying it
+		value_type entry(std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple(std::forward<Args>(args)...));
+		index = evict();
+		slot(index)->~value_type();
+		ret = new (&m_slots[index]) value_type(std::move(entry));
+	} else {
+		if (!m_free.empty()) {
+			index = m_free.back();
+			m_free.pop_back();
+		} else {
+			index = static_cast<index_t>(m_used++);
+		}
+		ret = new (&m_slots[index]) value_type(std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple(std::forward<Args>(args)...));
+	}
+	m_hashes[index] = h;
+	// probe after evicting: the backward shift may have opened an earlier position
+	m_index[empty_pos(h)] = index;
+	link_front(index);
+	++m_size;
+	return {&ret->second, true};
+}
+template <typename K, typename V, std::size_t N, lru_policy Policy, typename Hash, typename KeyEqual>
+template <typename U>
+std::pair<V*, bool> fixed_lru<K, V, N, Policy, Hash, KeyEqual>::insert_or_assign(K const& key, U&& value) {
+	auto ret = try_emplace(key, std::forward<U>(value));
+	if (!ret.second) { *ret.first = std::forward<U>(value); }
+	return ret;
+}
+template <typename K, typename V, std::size_t N, lru_policy Policy, typename Hash, typename KeyEqual>
+bool fixed_lru<K, V, N, Policy, Hash, KeyEqual>::erase(K const& key) {
+	size_type const pos = find_pos(key, hash(key));
+	if (pos == index_count) { return false; }
+	index_t const index = m_index[pos];
+	remove_pos(pos);
+	unlink(index);
+	slot(index)->~value_type();
+	m_free.push_back(index);
+	--m_size;
+	return true;
+}
+template <typename K, typename V, std::size_t N, lru_policy Policy, typename Hash, typename KeyEqual>
+typename fixed_lru<K, V, N, Policy, Hash, KeyEqual>::size_type fixed_lru<K, V, N, Policy, Hash, KeyEqual>::find_pos(K const& key, std::uint32_t h) const noexcept {
+	for (size_type pos = home(h);; pos = (pos + 1) & mask) {
+		index_t const index = m_index[pos];
+		if (index == npos) { return index_count; }
+		// the stored hash filters out nearly all mismatches before touching the entry
+		if (m_hashes[index] == h && KeyEqual{}(slot(index)->first, key)) { return pos; }
+	}
+}
+template <typename K, typename V, std::size_t N, lru_policy Policy, typename Hash, typename KeyEqual>
+typename fixed_lru<K, V, N, Policy, Hash, KeyEqual>::size_type fixed_lru<K, V, N, Policy, Hash, KeyEqual>::empty_pos(std::uint32_t h) const noexcept {
+	size_type pos = home(h);
+	while (m_index[pos] != npos) { pos = (pos + 1) & mask; }
+	return pos;
+}
+template <typename K, typename V, std::size_t N, lru_policy Policy, typename Hash, typename KeyEqual>
+void fixed_lru<K, V, N, Policy, Hash, KeyEqual>::remove_pos(size_type hole) noexcept {
+	auto const is_full = [this](size_type pos) { return m_index[pos] != npos; };
+	auto const home_of = [this](size_type pos) { return home(m_hashes[m_index[pos]]); };
+	auto const move = [this](size_type from, size_type to) { m_index[to] = m_index[from]; };
+	m_index[detail::backward_shift(hole, mask, is_full, home_of, move)] = npos;
+}
+template <typename K, typename V, std::size_t N, lru_policy Policy, typename Hash, typename KeyEqual>
+void fixed_lru<K, V, N, Policy, Hash, KeyEqual>::link_front(index_t index) noexcept {
+	if constexpr (Policy == lru_policy::clock) {
+		m_recency.referenced.reset(index);
+	} else {
+		auto& list = m_recency;
+		list.links[index] = {npos, list.head};
+		if (list.head != npos) {
+			list.links[list.head].prev = index;
+		} else {
+			list.tail = index;
+		}
+		list.head = index;
+	}
+}
+template <typename K, typename V, std::size_t N, lru_policy Policy, typename Hash, typename KeyEqual>
+void fixed_lru<K, V, N, Policy, Hash, KeyEqual>::unlink(index_t index) noexcept {
+	if constexpr (Policy == lru_policy::clock) {
+		m_recency.referenced.reset(index);
+	} else {
+		auto& list = m_recency;
+		auto const [prev, next] = list.links[index];
+		(prev != npos ? list.links[prev].next : list.head) = next;
+		(next != npos ? list.links[next].prev : list.tail) = prev;
+	}
+}
+template <typename K, typename V, std::size_t N, lru_policy Policy, typename Hash, typename KeyEqual>
+void fixed_lru<K, V, N, Policy, Hash, KeyEqual>::touch(index_t index) noexcept {
+	if constexpr (Policy == lru_policy::clock) {
+		m_recency.referenced.set(index);
+	} else {
+		if (m_recency.head == index) { return; }
+		unlink(index);
+		link_front(index);
+	}
+}
+template <typename K, typename V, std::size_t N, lru_policy Policy, typename Hash, typename KeyEqual>
+typename fixed_lru<K, V, N, Policy, Hash, KeyEqual>::index_t fixed_lru<K, V, N, Policy, Hash, KeyEqual>::evict() noexcept {
+	index_t victim = npos;
+	if constexpr (Policy == lru_policy::clock) {
+		// only called when full, so every slot under the hand is live
+		auto& ring = m_recency;
+		while (ring.referenced.test(ring.hand)) {
+			ring.referenced.reset(ring.hand);
+			ring.hand = ring.hand + 1 == N ? 0 : ring.hand + 1;
+		}
+		victim = static_cast<index_t>(ring.hand);
+		ring.hand = ring.hand + 1 == N ? 0 : ring.hand + 1;
+	} else {
+		victim = m_recency.tail;
+		unlink(victim);
+	}
+	remove_pos(find_pos(slot(victim)->first, m_hashes[victim]));
+	--m_size;
+	return victim;
+}
+template <typename K, typename V, std::size_t N, lru_policy Policy, typename Hash, typename KeyEqual>
+template <typename Lru>
+void fixed_lru<K, V, N, Policy, Hash, KeyEqual>::clone(Lru&& rhs) {
+	// same index size and hash: every entry keeps its slot and position
+	// hashes and links of slots that are free or never used are indeterminate, so only live slots are copied
+	for (index_t const index : rhs.m_index) {
+		if (index == npos) { continue; }
+		if constexpr (std::is_rvalue_reference_v<Lru&&>) {
+			new (&m_slots[index]) value_type(std::move(*rhs.slot(index)));
+		} else {
+			new (&m_slots[index]) value_type(*rhs.slot(index));
+		}
+		m_hashes[index] = rhs.m_hashes[index];
+		if constexpr (Policy == lru_policy::lru) { m_recency.links[index] = rhs.m_recency.links[index]; }
+	}
+	m_index = rhs.m_index;
+	if constexpr (Policy == lru_policy::clock) {
+		m_recency = rhs.m_recency;
+	} else {
+		m_recency.head = rhs.m_recency.head;
+		m_recency.tail = rhs.m_recency.tail;
+	}
+	m_free = rhs.m_free;
+	m_used = rhs.m_used;
+	m_size = rhs.m_size;
+}
+} // namespace kt
@@ -0,0 +1,157 @@
+// KT header-only library
+// Requirements: C++17
+
+#pragma once
+#include "fixed_vector.hpp"
+
+namespace kt {
+///
+/// \brief Vector of up to N unsigned values of Bits bits each, packed LSB-first into inline 64-bit words
+///
+template <std::size_t Bits, std::size_t N>
+class fixed_packed_vector {
+	static_assert(Bits >= 1 && Bits <= 32, "Bits must be in [1, 32]");
+
+  public:
+	using size_type = std::size_t;
+	using value_type = std::uint32_t;
+	using word_type = std::uint64_t;
+
+	static constexpr size_type bits = Bits;
+	static constexpr size_type word_bits = 64;
+	static constexpr value_type max_value = static_cast<value_type>((std::uint64_t{1} << Bits) - 1);
+	static constexpr size_type max_size() noexcept { return N; }
+
+	fixed_packed_vector() = default;
+	template <std::size_t M>
+	explicit fixed_packed_vector(fixed_vector<value_type, M> const& values) {
+		pack(values);
+	}
+
+	value_type at(size_type index) const noexcept;
+	value_type operator[](size_type index) const noexcept { return at(index); }
+	word_type const* words() const noexcept { return m_words.data(); }
+
+	bool empty() const noexcept { return m_size == 0; }
+	size_type size() const noexcept { return m_size; }
+	constexpr size_type capacity() const noexcept { return N; }
+	bool has_space() const noexcept { return m_size < N; }
+
+	void set(size_type index, value_type value) noexcept;
+	void clear() noexcept;
+	void push_back(value_type value) noexcept;
+	void pop_back() noexcept;
+
+	///
+	/// \brief Replace contents with values, each of which must fit in Bits
+	///
+	template <std::size_t M>
+	void pack(fixed_vector<value_type, M> const& values) noexcept;
+	///
+	/// \brief Append all values to out
+	///
+	template <std::size_t M>
+	void unpack(fixed_vector<value_type, M>& out) const;
+
+  private:
+	// one spare word so a value straddling the last live word can always read its successor
+	static constexpr size_type word_count = (N * Bits + word_bits - 1) / word_bits + 1;
+	static constexpr word_type mask = max_value;
+	// when Bits divides 64, no value straddles two words
+	static constexpr bool aligned = word_bits % Bits == 0;
+
+	std::array<word_type, word_count> m_words{};
+	size_type m_size = 0;
+};
+
+// impl
+
+template <std::size_t Bits, std::size_t N>
+typename fixed_packed_vector<Bits, N>::value_type fixed_packed_vector<Bits, N>::at(size_type index) const noexcept {
+	assert(index < m_size);
+	size_type const offset = index * Bits;
+	size_type const w = offset / word_bits;
+	size_type const shift = offset % word_bits;
+	word_type ret = m_words[w] >> shift;
+	if constexpr (!aligned) {
+		if (shift + Bits > word_bits) { ret |= m_words[w + 1] << (word_bits - shift); }
+	}
+	return static_cast<value_type>(ret & mask);
+}
+template <std::size_t Bits, std::size_t N>
+void fixed_packed_vector<Bits, N>::set(size_type index, value_type value) noexcept {
+	assert(index < m_size && value <= max_value);
+	size_type const offset = index * Bits;
+	size_type const w = offset / word_bits;
+	size_type const shift = offset % word_bits;
+	m_words[w] = (m_words[w] & ~(mask << shift)) | (static_cast<word_type>(value) << shift);
+	if constexpr (!aligned) {
+		if (shift + Bits > word_bits) {
+			size_type const spill = word_bits - shift;
+			m_words[w + 1] = (m_words[w + 1] & ~(mask >> spill)) | (static_cast<word_type>(value) >> spill);
+		}
+	}
+}
+template <std::size_t Bits, std::size_t N>
+void fixed_packed_vector<Bits, N>::clear() noexcept {
+	m_words.fill(0);
+	m_size = 0;
+}
+template <std::size_t Bits, std::size_t N>
+void fixed_packed_vector<Bits, N>::push_back(value_type value) noexcept {
+	assert(has_space());
+	++m_size;
+	set(m_size - 1, value);
+}
+template <std::size_t Bits, std::size_t N>
+void fixed_packed_vector<Bits, N>::pop_back() noexcept {
+	assert(!empty());
+	set(m_size - 1, 0);
+	--m_size;
+}
+template <std::size_t Bits, std::size_t N>
+template <std::size_t M>
+void fixed_packed_vector<Bits, N>::pack(fixed_vector<value_type, M> const& values) noexcept {
+	assert(values.size() <= N);
+	m_words.fill(0);
+	m_size = values.size();
+	value_type const* in = values.data();
+	// stream values through a 64-bit accumulator, emitting whole words
+	word_type acc = 0;
+	size_type filled = 0;
+	size_type w = 0;
+	for (size_type i = 0; i < m_size; ++i) {
+		assert(in[i] <= max_value);
+		word_type const value = in[i];
+		acc |= value << filled;
+		filled += Bits;
+		if (filled >= word_bits) {
+			m_words[w++] = acc;
+			filled -= word_bits;
+			acc = filled > 0 ? value >> (Bits - filled) : 0;
+		}
+	}
+	if (filled > 0) { m_words[w] = acc; }
+}
+template <std::size_t Bits, std::size_t N>
+template <std::size_t M>
+void fixed_packed_vector<Bits, N>::unpack(fixed_vector<value_type, M>& out) const {
+	size_type const first = out.size();
+	assert(first + m_size <= M);
+	// every slot is written below: skip the zero-fill of resize()
+	value_type* const dst = detail::fixed_vector_access::storage(out) + first;
+	if constexpr (aligned) {
+		// fixed shifts per word: unrolls and vectorizes
+		constexpr size_type per_word = word_bits / Bits;
+		size_type const full = m_size / per_word;
+		for (size_type w = 0; w < full; ++w) {
+			word_type const word = m_words[w];
+			for (size_type j = 0; j < per_word; ++j) { dst[w * per_word + j] = static_cast<value_type>((word >> (j * Bits)) & mask); }
+		}
+		for (size_type i = full * per_word; i < m_size; ++i) { dst[i] = at(i); }
+	} else {
+		for (size_type i = 0; i < m_size; ++i) { dst[i] = at(i); }
+	}
+	detail::fixed_vector_access::set_size(out, first + m_size);
+}
+} // namespace kt
@@ -0,0 +1,181 @@
+// KT header-only library
+// Requirements: C++17
+
+#pragma once
+#include "fixed_vector.hpp"
+
+namespace kt {
+namespace detail {
+struct heap_no_tracking {
+	template <typename T>
+	void operator()(T const&, std::size_t) const noexcept {}
+};
+} // namespace detail
+
+///
+/// \brief Priority queue of up to N elements on an inline d-ary heap
+/// top() is the greatest element by Compare (as std::priority_queue); Arity 4 keeps siblings in one or two cache lines.
+/// OnMove is invoked as on_move(element, index) whenever an element settles at a heap index,
+/// which lets callers maintain a position index for update() (decrease / increase key) and erase_at().
+///
+template <typename T, std::size_t N, typename Compare = std::less<T>, std::size_t Arity = 4, typename OnMove = detail::heap_no_tracking>
+class fixed_priority_queue {
+	static_assert(Arity >= 2, "Arity must be at least 2");
+
+  public:
+	using size_type = std::size_t;
+	using value_type = T;
+	using const_iterator = T const*;
+
+	static constexpr size_type arity = Arity;
+	static constexpr size_type max_size() noexcept { return N; }
+
+	fixed_priority_queue() = default;
+	explicit fixed_priority_queue(Compare comp, OnMove on_move = {}) : m_comp(std::move(comp)), m_on_move(std::move(on_move)) {}
+
+	T const& top() const noexcept { return m_heap.front(); }
+	///
+	/// \brief Element at heap index
+	///
+	T const& operator[](size_type index) const noexcept { return m_heap[index]; }
+	///
+	/// \brief Elements in heap order
+	///
+	const_iterator begin() const noexcept { return m_heap.data(); }
+	const_iterator end() const noexcept { return begin() + size(); }
+
+	bool empty() const noexcept { return m_heap.empty(); }
+	size_type size() const noexcept { return m_heap.size(); }
+	constexpr size_type capacity() const noexcept { return N; }
+	bool has_space() const noexcept { return m_heap.has_space(); }
+
+	void clear() noexcept { m_heap.clear(); }
+	void push(T const& t) { emplace(t); }
+	void push(T&& t) { emplace(std::move(t)); }
+	template <typename... Args>
+	void emplace(Args&&... args);
+	void pop();
+	///
+	/// \brief Replace top() with t: one sift instead of a pop and a push
+	///
+	void pop_push(T t);
+	///
+	/// \brief Append [first, last) and restore the heap bottom-up in O(n)
+	///
+	template <typename InputIt>
+	void heapify(InputIt first, InputIt last);
+	///
+	/// \brief Modify the element at heap index via f, then restore its position (decrease / increase key)
+	///
+	template <typename F>
+	void update(size_type index, F f);
+	///
+	/// \brief Remove the element at heap index
+	///
+	void erase_at(size_type index);
+
+  private:
+	static constexpr size_type parent(size_type index) noexcept { return (index - 1) / Arity; }
+
+	void place(size_type index, T&& t);
+	void sift_up(size_type index, T t);
+	void sift_down(size_type index, T t);
+
+	fixed_vector<T, N> m_heap;
+	Compare m_comp;
+	OnMove m_on_move;
+};
+
+// impl
+
+template <typename T, std::size_t N, typename Compare, std::size_t Arity, typename OnMove>
+template <typename... Args>
+void fixed_priority_queue<T, N, Compare, Arity, OnMove>::emplace(Args&&... args) {
+	assert(has_space());
+	T& back = m_heap.emplace_back(std::forward<Args>(args)...);
+	sift_up(size() - 1, std::move(back));
+}
+template <typename T, std::size_t N, typename Compare, std::size_t Arity, typename OnMove>
+void fixed_priority_queue<T, N, Compare, Arity, OnMove>::pop() {
+	assert(!empty());
+	if (size() == 1) {
+		m_heap.pop_back();
+		return;
+	}
+	T last = std::move(m_heap.back());
+	m_heap.pop_back();
+	sift_down(0, std::move(last));
+}
+template <typename T, std::size_t N, typename Compare, std::size_t Arity, typename OnMove>
+void fixed_priority_queue<T, N, Compare, Arity, OnMove>::pop_push(T t) {
+	assert(!empty());
+	sift_down(0, std::move(t));
+}
+template <typename T, std::size_t N, typename Compare, std::size_t Arity, typename OnMove>
+template <typename InputIt>
+void fixed_priority_queue<T, N, Compare, Arity, OnMove>::heapify(InputIt first, InputIt last) {
+	for (; first != last; ++first) { m_heap.push_back(*first); }
+	if (size() < 2) {
+		if (!empty()) { m_on_move(m_heap[0], 0); }
+		return;
+	}
+	// leaves are already heaps: report them, then sift every internal node down
+	size_type const last_parent = parent(size() - 1);
+	for (size_type i = last_parent + 1; i < size(); ++i) { m_on_move(m_heap[i], i); }
+	for (size_type i = last_parent + 1; i-- > 0;) { sift_down(i, std::move(m_heap[i])); }
+}
+template <typename T, std::size_t N, typename Compare, std::size_t Arity, typename OnMove>
+template <typename F>
+void fixed_priority_queue<T, N, Compare, Arity, OnMove>::update(size_type index, F f) {
+	assert(index < size());
+	f(m_heap[index]);
+	if (index > 0 && m_comp(m_heap[parent(index)], m_heap[index])) {
+		sift_up(index, std::move(m_heap[index]));
+	} else {
+		sift_down(index, std::move(m_heap[index]));
+	}
+}
+template <typename T, std::size_t N, typename Compare, std::size_t Arity, typename OnMove>
+void fixed_priority_queue<T, N, Compare, Arity, OnMove>::erase_at(size_type index) {
+	assert(index < size());
+	T last = std::move(m_heap.back());
+	m_heap.pop_back();
+	if (index == size()) { return; }
+	if (index > 0 && m_comp(m_heap[parent(index)], last)) {
+		sift_up(index, std::move(last));
+	} else {
+		sift_down(index, std::move(last));
+	}
+}
+template <typename T, std::size_t N, typename Compare, std::size_t Arity, typename OnMove>
+void fixed_priority_queue<T, N, Compare, Arity, OnMove>::place(size_type index, T&& t) {
+	m_heap[index] = std::move(t);
+	m_on_move(m_heap[index], index);
+}
+template <typename T, std::size_t N, typename Compare, std::size_t Arity, typename OnMove>
+void fixed_priority_queue<T, N, Compare, Arity, OnMove>::sift_up(size_type index, T t) {
+	// move the hole up instead of swapping
+	while (index > 0) {
+		size_type const up = parent(index);
+		if (!m_comp(m_heap[up], t)) { break; }
+		place(index, std::move(m_heap[up]));
+		index = up;
+	}
+	place(index, std::move(t));
+}
+template <typename T, std::size_t N, typename Compare, std::size_t Arity, typename OnMove>
+void fixed_priority_queue<T, N, Compare, Arity, OnMove>::sift_down(size_type index, T t) {
+	size_type const count = size();
+	while (true) {
+		size_type const first = index * Arity + 1;
+		if (first >= count) { break; }
+		size_type const last = first + Arity < count ? first + Arity : count;
+		size_type best = first;
+		for (size_type c = first + 1; c < last; ++c) { best = m_comp(m_heap[best], m_heap[c]) ? c : best; }
+		if (!m_comp(t, m_heap[best])) { break; }
+		place(index, std::move(m_heap[best]));
+		index = best;
+	}
+	place(index, std::move(t));
+}
+} // namespace kt
@@ -0,0 +1,243 @@
+// KT header-only library
+// Requirements: C++17
+
+#pragma once
+#include <cmath>
+#include "fixed_vector.hpp"
+
+namespace kt {
+namespace detail {
+// Merge sorted [first, first + count) into sorted vec from the back, so no scratch buffer is needed
+template <std::size_t M>
+void merge_sorted_back(fixed_vector<float, M>& vec, float const* first, std::size_t count) {
+	std::size_t i = vec.size();
+	std::size_t j = count;
+	vec.resize(i + count);
+	float* const data = vec.data();
+	for (std::size_t k = i + j; j > 0;) { data[--k] = (i > 0 && first[j - 1] < data[i - 1]) ? data[--i] : first[--j]; }
+}
+} // namespace detail
+
+///
+/// \brief Streaming quantile estimator (KLL-style) in a compile-time memory bound
+/// Level i holds up to K samples of weight 2^i; a full level is compacted by promoting every other sample
+/// (from a random offset), halving it while keeping ranks unbiased. The top level compacts into itself, doubling
+/// its weight, and samples arriving at a lighter weight are admitted with probability proportional to it.
+/// Level 0 is an unsorted input buffer that is sorted when it compacts; every level above it is kept sorted by
+/// merging promoted samples in, so quantile() and rank() walk the levels without copying or re-sorting them.
+/// Retains at most K * Levels floats; rank error shrinks as K grows, Levels only bounds the exact-weight range.
+///
+template <std::size_t K, std::size_t Levels = 16>
+class fixed_quantile_sketch {
+	static_assert(K >= 2 && K % 2 == 0, "K must be even and at least 2");
+	static_assert(Levels >= 1 && Levels < 64, "Levels must be in [1, 64)");
+
+  public:
+	using size_type = std::size_t;
+	using value_type = float;
+
+	///
+	/// \brief Number of samples inserted (including via merge)
+	///
+	std::uint64_t count() const noexcept { return m_count; }
+	///
+	/// \brief Number of samples currently held
+	///
+	size_type retained() const noexcept;
+	bool empty() const noexcept { return m_count == 0; }
+	static constexpr size_type capacity() noexcept { return K * Levels; }
+
+	void insert(float x);
+	template <typename InputIt>
+	void insert(InputIt first, InputIt last);
+	///
+	/// \brief Fold rhs into this sketch, as if its samples had been inserted here
+	///
+	void merge(fixed_quantile_sketch const& rhs);
+	void clear() noexcept;
+
+	///
+	/// \brief Estimated value at normalized rank q in [0, 1]
+	///
+	float quantile(double q) const;
+	///
+	/// \brief Estimated fraction of samples <= x
+	///
+	double rank(float x) const noexcept;
+
+  private:
+	static constexpr size_type top = Levels - 1;
+
+	std::uint64_t next_random() noexcept { return detail::hash_mix(m_rng += 0x9e3779b97f4a7c15ULL); }
+	std::uint64_t level_weight(size_type level) const noexcept { return level == top ? m_top_weight : std::uint64_t{1} << level; }
+	void push(float x);
+	// Merge sorted [first, first + count) into level, compacting it first if it would overflow
+	void absorb(size_type level, float const* first, size_type count);
+	void absorb_top(float const* first, size_type count, std::uint64_t weight);
+	void compact(size_type level);
+	void compact_top();
+	template <std::size_t M>
+	void halve(fixed_vector<float, M>& samples);
+
+	std::array<fixed_vector<float, K>, Levels> m_levels;
+	std::uint64_t m_top_weight = std::uint64_t{1} << top;
+	std::uint64_t m_count = 0;
+	std::uint64_t m_rng = 0;
+};
+
+// impl
+
+template <std::size_t K, std::size_t Levels>
+typename fixed_quantile_sketch<K, Levels>::size_type fixed_quantile_sketch<K, Levels>::retained() const noexcept {
+	size_type ret = 0;
+	for (auto const& level : m_levels) { ret += level.size(); }
+	return ret;
+}
+template <std::size_t K, std::size_t Levels>
+void fixed_quantile_sketch<K, Levels>::insert(float x) {
+	assert(!std::isnan(x));
+	++m_count;
+	push(x);
+}
+template <std::size_t K, std::size_t Levels>
+template <typename InputIt>
+void fixed_quantile_sketch<K, Levels>::insert(InputIt first, InputIt last) {
+	for (; first != last; ++first) { insert(*first); }
+}
+template <std::size_t K, std::size_t Levels>
+void fixed_quantile_sketch<K, Levels>::merge(fixed_quantile_sketch const& rhs) {
+	assert(&rhs != this);
+	m_count += rhs.m_count;
+	auto const& buffer = rhs.m_levels[0];
+	if constexpr (top == 0) {
+		absorb_top(buffer.data(), buffer.size(), rhs.m_top_weight);
+	} else {
+		for (size_type i = 0; i < buffer.size(); ++i) { push(buffer[i]); }
+		for (size_type level = 1; level < top; ++level) { absorb(level, rhs.m_levels[level].data(), rhs.m_levels[level].size()); }
+		absorb_top(rhs.m_levels[top].data(), rhs.m_levels[top].size(), rhs.m_top_weight);
+	}
+}
+template <std::size_t K, std::size_t Levels>
+void fixed_quantile_sketch<K, Levels>::clear() noexcept {
+	for (auto& level : m_levels) { level.clear(); }
+	m_top_weight = std::uint64_t{1} << top;
+	m_count = 0;
+}
+template <std::size_t K, std::size_t Levels>
+float fixed_quantile_sketch<K, Levels>::quantile(double q) const {
+	assert(!empty() && q >= 0.0 && q <= 1.0);
+	// only the level 0 buffer needs sorting; the rest are merged in place by a weighted k-way walk
+	fixed_vector<float, K> buffer(m_levels[0].data(), m_levels[0].data() + m_levels[0].size());
+	std::sort(buffer.data(), buffer.data() + buffer.size());
+	struct cursor_t {
+		float const* it;
+		float const* end;
+		std::uint64_t weight;
+	};
+	cursor_t cursors[Levels];
+	size_type active = 0;
+	std::uint64_t total = 0;
+	for (size_type level = 0; level < Levels; ++level) {
+		size_type const size = m_levels[level].size();
+		if (size == 0) { continue; }
+		float const* const data = level == 0 ? buffer.data() : m_levels[level].data();
+		cursors[active++] = {data, data + size, level_weight(level)};
+		total += level_weight(level) * size;
+	}
+	double const target = q * static_cast<double>(total);
+	std::uint64_t cumulative = 0;
+	float ret = 0.0f;
+	while (active > 0) {
+		size_type best = 0;
+		for (size_type c = 1; c < active; ++c) { best = *cursors[c].it < *cursors[best].it ? c : best; }
+		ret = *cursors[best].it++;
+		cumulative += cursors[best].weight;
+		if (static_cast<double>(cumulative) >= target) { break; }
+		if (cursors[best].it == cursors[best].end) { cursors[best] = cursors[--active]; }
+	}
+	return ret;
+}
+template <std::size_t K, std::size_t Levels>
+double fixed_quantile_sketch<K, Levels>::rank(float x) const noexcept {
+	std::uint64_t below = 0;
+	std::uint64_t total = 0;
+	for (size_type level = 0; level < Levels; ++level) {
+		std::uint64_t const weight = level_weight(level);
+		float const* const data = m_levels[level].data();
+		size_type const size = m_levels[level].size();
+		size_type count = 0;
+		if (level == 0 && top > 0) {
+			for (size_type i = 0; i < size; ++i) { count += data[i] <= x; }
+		} else if (size > 0) {
+			count = static_cast<size_type>(std::upper_bound(data, data + size, x) - data);
+		}
+		below += weight * count;
+		total += weight * m_levels[level].size();
+	}
+	return total == 0 ? 0.0 : static_cast<double>(below) / static_cast<double>(total);
+}
+template <std::size_t K, std::size_t Levels>
+void fixed_quantile_sketch<K, Levels>::push(float x) {
+	if constexpr (top == 0) {
+		absorb_top(&x, 1, 1);
+	} else {
+		if (!m_levels[0].has_space()) { compact(0); }
+		m_levels[0].push_back(x);
+	}
+}
+template <std::size_t K, std::size_t Levels>
+void fixed_quantile_sketch<K, Levels>::absorb(size_type level, float const* first, size_type count) {
+	if (level == top) {
+		absorb_top(first, count, std::uint64_t{1} << level);
+		return;
+	}
+	if (m_levels[level].size() + count > K) { compact(level); }
+	detail::merge_sorted_back(m_levels[level], first, count);
+}
+template <std::size_t K, std::size_t Levels>
+void fixed_quantile_sketch<K, Levels>::absorb_top(float const* first, size_type count, std::uint64_t weight) {
+	while (weight > m_top_weight) { compact_top(); }
+	// weights are powers of two: admit with probability weight / m_top_weight
+	fixed_vector<float, K> admitted;
+	for (size_type i = 0; i < count; ++i) {
+		if ((next_random() & (m_top_weight / weight - 1)) == 0) { admitted.push_back(first[i]); }
+	}
+	auto& samples = m_levels[top];
+	if (samples.size() + admitted.size() <= K) {
+		detail::merge_sorted_back(samples, admitted.data(), admitted.size());
+		return;
+	}
+	// both halves together exceed K (and fit in 2K): compact their union into the top level
+	fixed_vector<float, 2 * K> all(samples.data(), samples.data() + samples.size());
+	detail::merge_sorted_back(all, admitted.data(), admitted.size());
+	halve(all);
+	m_top_weight *= 2;
+	samples.clear();
+	samples.insert(samples.end(), all.data(), all.data() + all.size());
+}
+template <std::size_t K, std::size_t Levels>
+void fixed_quantile_sketch<K, Levels>::compact(size_type level) {
+	auto& samples = m_levels[level];
+	float* const data = samples.data();
+	// levels above 0 are already sorted
+	if (level == 0) { std::sort(data, data + samples.size()); }
+	fixed_vector<float, K / 2> promoted;
+	for (size_type i = next_random() & 1; i < samples.size(); i += 2) { promoted.push_back(data[i]); }
+	samples.clear();
+	absorb(level + 1, promoted.data(), promoted.size());
+}
+template <std::size_t K, std::size_t Levels>
+void fixed_quantile_sketch<K, Levels>::compact_top() {
+	halve(m_levels[top]);
+	m_top_weight *= 2;
+}
+template <std::size_t K, std::size_t Levels>
+template <std::size_t M>
+void fixed_quantile_sketch<K, Levels>::halve(fixed_vector<float, M>& samples) {
+	// every other sample from a random offset; order is preserved
+	float* const data = samples.data();
+	size_type kept = 0;
+	for (size_type i = next_random() & 1; i < samples.size(); i += 2) { data[kept++] = data[i]; }
+	samples.resize(kept);
+}
+} // namespace kt
@@ -0,0 +1,128 @@
+// KT header-only library
+// Requirements: C++17
+
+#pragma once
+#include <cmath>
+#include <random>
+#include "fixed_vector.hpp"
+
+namespace kt {
+///
+/// \brief Uniform random sample of K values from a stream of unknown length
+/// Uses Algorithm L: after the first K values it draws how many values to skip before the next
+/// replacement, so RNG and log / exp cost is per admitted value, O(K (1 + log(n / K))) in total.
+///
+template <typename T, std::size_t K, typename URBG = std::mt19937_64>
+class fixed_reservoir {
+	static_assert(K > 0, "K must be positive");
+
+  public:
+	using size_type = std::size_t;
+	using value_type = T;
+	using const_iterator = T const*;
+
+	static constexpr size_type max_size() noexcept { return K; }
+
+	fixed_reservoir() = default;
+	explicit fixed_reservoir(URBG rng) : m_rng(std::move(rng)) {}
+
+	const_iterator begin() const noexcept { return m_sample.data(); }
+	const_iterator end() const noexcept { return begin() + size(); }
+	fixed_vector<T, K> const& sample() const noexcept { return m_sample; }
+
+	bool empty() const noexcept { return m_sample.empty(); }
+	size_type size() const noexcept { return m_sample.size(); }
+	constexpr size_type capacity() const noexcept { return K; }
+	///
+	/// \brief Number of values offered so far
+	///
+	std::uint64_t seen() const noexcept { return m_seen; }
+
+	void clear() noexcept;
+	void offer(T const& t);
+	template <typename InputIt>
+	void offer(InputIt first, InputIt last);
+
+  private:
+	double uniform() {
+		// (0, 1): log() of the draw must be finite
+		double ret{};
+		do { ret = std::uniform_real_distribution<double>(0.0, 1.0)(m_rng); } while (ret == 0.0);
+		return ret;
+	}
+	void advance_weight() { m_weight *= std::exp(std::log(uniform()) / static_cast<double>(K)); }
+	void draw_skip();
+	void replace(T const& t);
+
+	fixed_vector<T, K> m_sample;
+	URBG m_rng;
+	std::uint64_t m_seen = 0;
+	// values still to be skipped before the next replacement
+	std::uint64_t m_skip = 0;
+	double m_weight = 1.0;
+};
+
+// impl
+
+template <typename T, std::size_t K, typename URBG>
+void fixed_reservoir<T, K, URBG>::clear() noexcept {
+	m_sample.clear();
+	m_seen = 0;
+	m_skip = 0;
+	m_weight = 1.0;
+}
+template <typename T, std::size_t K, typename URBG>
+void fixed_reservoir<T, K, URBG>::offer(T const& t) {
+	++m_seen;
+	if (m_sample.has_space()) {
+		m_sample.push_back(t);
+		if (!m_sample.has_space()) {
+			advance_weight();
+			draw_skip();
+		}
+		return;
+	}
+	if (m_skip > 0) {
+		--m_skip;
+		return;
+	}
+	replace(t);
+}
+template <typename T, std::size_t K, typename URBG>
+template <typename InputIt>
+void fixed_reservoir<T, K, URBG>::offer(InputIt first, InputIt last) {
+	for (; first != last && m_sample.has_space(); ++first) { offer(*first); }
+	if constexpr (std::is_base_of_v<std::random_access_iterator_tag, typename std::iterator_traits<InputIt>::iterator_category>) {
+		// jump straight to the next replacement
+		while (first != last) {
+			auto const remain = static_cast<std::uint64_t>(last - first);
+			if (m_skip >= remain) {
+				m_skip -= remain;
+				m_seen += remain;
+				return;
+			}
+			first += static_cast<typename std::iterator_traits<InputIt>::difference_type>(m_skip);
+			m_seen += m_skip + 1;
+			m_skip = 0;
+			replace(*first);
+			++first;
+		}
+	} else {
+		for (; first != last; ++first) { offer(*first); }
+	}
+}
+template <typename T, std::size_t K, typename URBG>
+void fixed_reservoir<T, K, URBG>::draw_skip() {
+	double const denom = std::log1p(-m_weight);
+	double const skip = denom < 0.0 ? std::floor(std::log(uniform()) / denom) : 0.0;
+	// saturate: a skip this long outlasts any stream
+	m_skip = skip < 1.8e19 ? static_cast<std::uint64_t>(skip) : ~std::uint64_t{};
+}
+template <typename T, std::size_t K, typename URBG>
+void fixed_reservoir<T, K, URBG>::replace(T const& t) {
+	auto const index = std::uniform_int_distribution<size_type>(0, K - 1)(m_rng);
+	m_sample[index] = t;
+	advance_weight();
+	draw_skip();
+}
+} // namespace kt
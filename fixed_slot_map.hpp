@@ -0,0 +1,208 @@
+// KT header-only library
+// Requirements: C++17
+
+#pragma once
+#include "fixed_vector.hpp"
+
+namespace kt {
+///
+/// \brief Dense array of up to N values addressed through stable generational handles
+/// Values are stored contiguously (erase swaps back() into the hole); a sparse slot table maps handles to
+/// dense indices and threads an embedded free list. Handles pack slot index and generation into 32 bits
+/// (64 bits when N needs more than 16 index bits); a handle is invalidated when its value is erased.
+///
+template <typename T, std::size_t N>
+class fixed_slot_map {
+	static constexpr bool small_v = N < (std::size_t{1} << 16);
+	using index_t = std::conditional_t<small_v, std::uint16_t, std::uint32_t>;
+
+  public:
+	using size_type = std::size_t;
+	using value_type = T;
+	using handle_type = std::conditional_t<small_v, std::uint32_t, std::uint64_t>;
+	using iterator = T*;
+	using const_iterator = T const*;
+
+	static constexpr handle_type null_handle = 0;
+	static constexpr size_type max_size() noexcept { return N; }
+
+	fixed_slot_map() = default;
+	fixed_slot_map(fixed_slot_map&& rhs) noexcept;
+	fixed_slot_map(fixed_slot_map const& rhs);
+	fixed_slot_map& operator=(fixed_slot_map&& rhs) noexcept;
+	fixed_slot_map& operator=(fixed_slot_map const& rhs);
+
+	///
+	/// \returns Pointer to the value for handle, or nullptr if the handle is stale
+	///
+	T* get(handle_type handle) noexcept;
+	T const* get(handle_type handle) const noexcept;
+	bool contains(handle_type handle) const noexcept { return get(handle) != nullptr; }
+	///
+	/// \brief Handle of the value at dense index
+	///
+	handle_type handle_at(size_type index) const noexcept;
+
+	iterator begin() noexcept { return m_values.data(); }
+	iterator end() noexcept { return begin() + size(); }
+	const_iterator begin() const noexcept { return m_values.data(); }
+	const_iterator end() const noexcept { return begin() + size(); }
+	fixed_vector<T, N> const& values() const noexcept { return m_values; }
+
+	bool empty() const noexcept { return m_values.empty(); }
+	size_type size() const noexcept { return m_values.size(); }
+	constexpr size_type capacity() const noexcept { return N; }
+	bool has_space() const noexcept { return m_values.has_space(); }
+
+	template <typename... Args>
+	handle_type emplace(Args&&... args);
+	handle_type insert(T const& t) { return emplace(t); }
+	handle_type insert(T&& t) { return emplace(std::move(t)); }
+	///
+	/// \returns Whether handle referred to a live value
+	///
+	bool erase(handle_type handle);
+	void clear() noexcept;
+
+  private:
+	static constexpr unsigned index_bits = small_v ? 16 : 32;
+	static constexpr index_t npos = static_cast<index_t>(-1);
+
+	struct slot_t {
+		// dense index while live, next free slot otherwise
+		index_t target;
+		// odd while live
+		index_t generation;
+	};
+
+	static handle_type make_handle(index_t slot, index_t generation) noexcept {
+		return static_cast<handle_type>((static_cast<handle_type>(generation) << index_bits) | slot);
+	}
+	static index_t slot_of(handle_type handle) noexcept { return static_cast<index_t>(handle); }
+	static index_t generation_of(handle_type handle) noexcept { return static_cast<index_t>(handle >> index_bits); }
+	slot_t const* find(handle_type handle) const noexcept;
+	void release(index_t slot) noexcept;
+	void clone_slots(fixed_slot_map const& rhs) noexcept;
+	void release_moved() noexcept;
+
+	fixed_vector<T, N> m_values;
+	fixed_vector<index_t, N> m_dense_to_slot;
+	// slots past m_slots_used have never been handed out, so need no initialization
+	std::array<slot_t, N> m_slots;
+	size_type m_slots_used = 0;
+	index_t m_free = npos;
+};
+
+// impl
+
+template <typename T, std::size_t N>
+fixed_slot_map<T, N>::fixed_slot_map(fixed_slot_map&& rhs) noexcept : m_values(std::move(rhs.m_values)), m_dense_to_slot(rhs.m_dense_to_slot) {
+	clone_slots(rhs);
+	rhs.release_moved();
+}
+template <typename T, std::size_t N>
+fixed_slot_map<T, N>::fixed_slot_map(fixed_slot_map const& rhs) : m_values(rhs.m_values), m_dense_to_slot(rhs.m_dense_to_slot) {
+	clone_slots(rhs);
+}
+template <typename T, std::size_t N>
+fixed_slot_map<T, N>& fixed_slot_map<T, N>::operator=(fixed_slot_map&& rhs) noexcept {
+	if (&rhs != this) {
+		m_values = std::move(rhs.m_values);
+		m_dense_to_slot = rhs.m_dense_to_slot;
+		clone_slots(rhs);
+		rhs.release_moved();
+	}
+	return *this;
+}
+template <typename T, std::size_t N>
+fixed_slot_map<T, N>& fixed_slot_map<T, N>::operator=(fixed_slot_map const& rhs) {
+	if (&rhs != this) {
+		m_values = rhs.m_values;
+		m_dense_to_slot = rhs.m_dense_to_slot;
+		clone_slots(rhs);
+	}
+	return *this;
+}
+template <typename T, std::size_t N>
+T* fixed_slot_map<T, N>::get(handle_type handle) noexcept {
+	slot_t const* slot = find(handle);
+	return slot ? &m_values[slot->target] : nullptr;
+}
+template <typename T, std::size_t N>
+T const* fixed_slot_map<T, N>::get(handle_type handle) const noexcept {
+	slot_t const* slot = find(handle);
+	return slot ? &m_values[slot->target] : nullptr;
+}
+template <typename T, std::size_t N>
+typename fixed_slot_map<T, N>::handle_type fixed_slot_map<T, N>::handle_at(size_type index) const noexcept {
+	index_t const slot = m_dense_to_slot[index];
+	return make_handle(slot, m_slots[slot].generation);
+}
+template <typename T, std::size_t N>
+template <typename... Args>
+typename fixed_slot_map<T, N>::handle_type fixed_slot_map<T, N>::emplace(Args&&... args) {
+	assert(has_space());
+	index_t slot = m_free;
+	if (slot != npos) {
+		m_free = m_slots[slot].target;
+		++m_slots[slot].generation;
+	} else {
+		slot = static_cast<index_t>(m_slots_used++);
+		m_slots[slot].generation = 1;
+	}
+	m_slots[slot].target = static_cast<index_t>(m_values.size());
+	m_values.emplace_back(std::forward<Args>(args)...);
+	m_dense_to_slot.push_back(slot);
+	return make_handle(slot, m_slots[slot].generation);
+}
+template <typename T, std::size_t N>
+bool fixed_slot_map<T, N>::erase(handle_type handle) {
+	slot_t const* found = find(handle);
+	if (!found) { return false; }
+	index_t const slot = slot_of(handle);
+	index_t const dense = found->target;
+	index_t const last = static_cast<index_t>(m_values.size() - 1);
+	if (dense != last) {
+		m_values[dense] = std::move(m_values[last]);
+		m_dense_to_slot[dense] = m_dense_to_slot[last];
+		m_slots[m_dense_to_slot[dense]].target = dense;
+	}
+	m_values.pop_back();
+	m_dense_to_slot.pop_back();
+	release(slot);
+	return true;
+}
+template <typename T, std::size_t N>
+void fixed_slot_map<T, N>::clear() noexcept {
+	for (index_t const slot : m_dense_to_slot) { release(slot); }
+	m_values.clear();
+	m_dense_to_slot.clear();
+}
+template <typename T, std::size_t N>
+typename fixed_slot_map<T, N>::slot_t const* fixed_slot_map<T, N>::find(handle_type handle) const noexcept {
+	index_t const slot = slot_of(handle);
+	if (slot >= m_slots_used) { return nullptr; }
+	slot_t const& ret = m_slots[slot];
+	return ret.generation == generation_of(handle) && (ret.generation & 1) ? &ret : nullptr;
+}
+template <typename T, std::size_t N>
+void fixed_slot_map<T, N>::release(index_t slot) noexcept {
+	// live slots have odd generations: bumping to even invalidates outstanding handles (and keeps null_handle invalid)
+	++m_slots[slot].generation;
+	m_slots[slot].target = m_free;
+	m_free = slot;
+}
+template <typename T, std::size_t N>
+void fixed_slot_map<T, N>::clone_slots(fixed_slot_map const& rhs) noexcept {
+	// only slots below m_slots_used have ever been written
+	std::copy_n(rhs.m_slots.begin(), rhs.m_slots_used, m_slots.begin());
+	m_slots_used = rhs.m_slots_used;
+	m_free = rhs.m_free;
+}
+template <typename T, std::size_t N>
+void fixed_slot_map<T, N>::release_moved() noexcept {
+	// m_values has already been moved out: invalidate the handles that referred to it
+	for (index_t const slot : m_dense_to_slot) { release(slot); }
+	m_dense_to_slot.clear();
+}
+} // namespace kt
@@ -0,0 +1,170 @@
+// KT header-only library
+// Requirements: C++17
+
+#pragma once
+#include <tuple>
+#include "fixed_vector.hpp"
+
+namespace kt {
+///
+/// \brief Non-owning contiguous view of one column
+///
+template <typename T>
+class column_view {
+  public:
+	using size_type = std::size_t;
+	using value_type = std::remove_const_t<T>;
+
+	column_view() = default;
+	column_view(T* data, size_type size) noexcept : m_data(data), m_size(size) {}
+
+	T* data() const noexcept { return m_data; }
+	size_type size() const noexcept { return m_size; }
+	bool empty() const noexcept { return m_size == 0; }
+	T* begin() const noexcept { return m_data; }
+	T* end() const noexcept { return m_data + m_size; }
+	T& operator[](size_type index) const noexcept {
+		assert(index < m_size);
+		return m_data[index];
+	}
+
+  private:
+	T* m_data{};
+	size_type m_size{};
+};
+
+///
+/// \brief Structure-of-arrays vector: one inline fixed_vector per field, kept in lockstep
+/// Element access takes and returns tuples of (references to) fields
+///
+template <std::size_t N, typename... Ts>
+class fixed_soa_vector {
+	static_assert(sizeof...(Ts) > 0, "At least one column required");
+
+  public:
+	using size_type = std::size_t;
+	using value_type = std::tuple<Ts...>;
+	using reference = std::tuple<Ts&...>;
+	using const_reference = std::tuple<Ts const&...>;
+	template <std::size_t I>
+	using column_t = std::tuple_element_t<I, value_type>;
+
+	static constexpr size_type max_size() noexcept { return N; }
+	static constexpr size_type column_count = sizeof...(Ts);
+
+	reference at(size_type index) noexcept { return at(index, indices{}); }
+	const_reference at(size_type index) const noexcept { return at(index, indices{}); }
+	reference operator[](size_type index) noexcept { return at(index); }
+	const_reference operator[](size_type index) const noexcept { return at(index); }
+	reference front() noexcept { return at(0); }
+	const_reference front() const noexcept { return at(0); }
+	reference back() noexcept { return at(size() - 1); }
+	const_reference back() const noexcept { return at(size() - 1); }
+
+	template <std::size_t I>
+	column_view<column_t<I>> column() noexcept {
+		auto& col = std::get<I>(m_columns);
+		return {col.data(), col.size()};
+	}
+	template <std::size_t I>
+	column_view<column_t<I> const> column() const noexcept {
+		auto const& col = std::get<I>(m_columns);
+		return {col.data(), col.size()};
+	}
+
+	bool empty() const noexcept { return size() == 0; }
+	size_type size() const noexcept { return std::get<0>(m_columns).size(); }
+	constexpr size_type capacity() const noexcept { return N; }
+	bool has_space() const noexcept { return size() < N; }
+
+	void clear() noexcept {
+		each_column([](auto& col) { col.clear(); });
+	}
+	template <typename... Args>
+	reference emplace_back(Args&&... args);
+	reference push_back(Ts const&... ts) { return emplace_back(ts...); }
+	reference push_back(value_type const& value) { return std::apply([this](Ts const&... ts) -> reference { return emplace_back(ts...); }, value); }
+	template <typename... Args>
+	reference insert(size_type index, Args&&... args);
+	void erase(size_type index);
+	void erase(size_type first, size_type last);
+	///
+	/// \brief Erase element at index by moving back() into it; does not preserve order
+	///
+	void erase_unordered(size_type index);
+	void pop_back() noexcept {
+		each_column([](auto& col) { col.pop_back(); });
+	}
+	///
+	/// \brief Invoke f(Ts&...) on each element
+	///
+	template <typename F>
+	void for_each(F&& f);
+
+  private:
+	using indices = std::index_sequence_for<Ts...>;
+
+	template <std::size_t... I>
+	reference at(size_type index, std::index_sequence<I...>) noexcept {
+		return reference(std::get<I>(m_columns)[index]...);
+	}
+	template <std::size_t... I>
+	const_reference at(size_type index, std::index_sequence<I...>) const noexcept {
+		return const_reference(std::get<I>(m_columns)[index]...);
+	}
+	template <typename F>
+	void each_column(F f) {
+		std::apply([&f](auto&... cols) { (f(cols), ...); }, m_columns);
+	}
+
+	std::tuple<fixed_vector<Ts, N>...> m_columns;
+};
+
+// impl
+
+template <std::size_t N, typename... Ts>
+template <typename... Args>
+typename fixed_soa_vector<N, Ts...>::reference fixed_soa_vector<N, Ts...>::emplace_back(Args&&... args) {
+	static_assert(sizeof...(Args) == sizeof...(Ts), "One argument per column required");
+	assert(has_space());
+	std::apply([&](auto&... cols) { (cols.emplace_back(std::forward<Args>(args)), ...); }, m_columns);
+	return back();
+}
+template <std::size_t N, typename... Ts>
+template <typename... Args>
+typename fixed_soa_vector<N, Ts...>::reference fixed_soa_vector<N, Ts...>::insert(size_type index, Args&&... args) {
+	static_assert(sizeof...(Args) == sizeof...(Ts), "One argument per column required");
+	assert(has_space() && index <= size());
+	auto const pos = static_cast<std::ptrdiff_t>(index);
+	std::apply([&](auto&... cols) { (cols.emplace(cols.cbegin() + pos, std::forward<Args>(args)), ...); }, m_columns);
+	return at(index);
+}
+template <std::size_t N, typename... Ts>
+void fixed_soa_vector<N, Ts...>::erase(size_type index) {
+	assert(index < size());
+	auto const pos = static_cast<std::ptrdiff_t>(index);
+	each_column([pos](auto& col) { col.erase(col.cbegin() + pos); });
+}
+template <std::size_t N, typename... Ts>
+void fixed_soa_vector<N, Ts...>::erase(size_type first, size_type last) {
+	assert(first <= last && last <= size());
+	auto const f = static_cast<std::ptrdiff_t>(first);
+	auto const l = static_cast<std::ptrdiff_t>(last);
+	each_column([f, l](auto& col) { col.erase(col.cbegin() + f, col.cbegin() + l); });
+}
+template <std::size_t N, typename... Ts>
+void fixed_soa_vector<N, Ts...>::erase_unordered(size_type index) {
+	assert(index < size());
+	auto const pos = static_cast<std::ptrdiff_t>(index);
+	each_column([pos](auto& col) { col.erase_unordered(col.cbegin() + pos); });
+}
+template <std::size_t N, typename... Ts>
+template <typename F>
+void fixed_soa_vector<N, Ts...>::for_each(F&& f) {
+	std::apply(
+		[&](auto&... cols) {
+			for (size_type i = 0; i < size(); ++i) { f(cols.data()[i]...); }
+		},
+		m_columns);
+}
+} // namespace kt
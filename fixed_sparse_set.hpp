@@ -0,0 +1,71 @@
+// KT header-only library
+// Requirements: C++17
+
+#pragma once
+#include "fixed_vector.hpp"
+
+namespace kt {
+///
+/// \brief Set of integer ids in [0, N) with O(1) insert, contains, erase and clear
+/// Members are kept densely for iteration; a sparse array maps each id to its dense position,
+/// and membership is confirmed by the dense entry pointing back, so clear() only resets the size.
+///
+template <std::size_t N>
+class fixed_sparse_set {
+  public:
+	using size_type = std::size_t;
+	using value_type = std::conditional_t<(N <= 0x100), std::uint8_t, std::conditional_t<(N <= 0x10000), std::uint16_t, std::uint32_t>>;
+	using const_iterator = value_type const*;
+	using iterator = const_iterator;
+
+	static constexpr size_type max_size() noexcept { return N; }
+
+	const_iterator begin() const noexcept { return m_dense.data(); }
+	const_iterator end() const noexcept { return begin() + size(); }
+	fixed_vector<value_type, N> const& members() const noexcept { return m_dense; }
+
+	bool empty() const noexcept { return m_dense.empty(); }
+	size_type size() const noexcept { return m_dense.size(); }
+	constexpr size_type capacity() const noexcept { return N; }
+
+	bool contains(size_type id) const noexcept {
+		assert(id < N);
+		size_type const pos = m_sparse[id];
+		return pos < m_dense.size() && m_dense[pos] == id;
+	}
+	///
+	/// \returns Whether id was inserted
+	///
+	bool insert(size_type id) noexcept;
+	///
+	/// \returns Whether id was erased
+	///
+	bool erase(size_type id) noexcept;
+	void clear() noexcept { m_dense.clear(); }
+
+  private:
+	fixed_vector<value_type, N> m_dense;
+	// stale entries are harmless: they fail the dense back-pointer check
+	std::array<value_type, N> m_sparse{};
+};
+
+// impl
+
+template <std::size_t N>
+bool fixed_sparse_set<N>::insert(size_type id) noexcept {
+	if (contains(id)) { return false; }
+	m_sparse[id] = static_cast<value_type>(m_dense.size());
+	m_dense.push_back(static_cast<value_type>(id));
+	return true;
+}
+template <std::size_t N>
+bool fixed_sparse_set<N>::erase(size_type id) noexcept {
+	if (!contains(id)) { return false; }
+	value_type const pos = m_sparse[id];
+	value_type const last = m_dense.back();
+	m_dense[pos] = last;
+	m_sparse[last] = pos;
+	m_dense.pop_back();
+	return true;
+}
+} // namespace kt
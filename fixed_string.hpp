@@ -0,0 +1,208 @@
+// KT header-only library
+// Requirements: C++17
+
+#pragma once
+#include <charconv>
+#include <string_view>
+#include "fixed_vector.hpp"
+
+namespace kt {
+///
+/// \brief Null-terminated string of up to N chars on inline storage
+/// Searches and comparisons go through std::string_view (memchr / memcmp);
+/// numbers are formatted with std::to_chars directly into the spare capacity
+/// Storage is a plain char array rather than fixed_vector<char, N + 1>: the terminator must sit at data()[size()]
+/// and to_chars writes past size() before the length is known, neither of which fixed_vector's API permits
+///
+template <std::size_t N>
+class fixed_string {
+	template <typename T>
+	using enable_if_number = std::enable_if_t<std::is_arithmetic_v<T> && !std::is_same_v<T, bool> && !std::is_same_v<T, char>>;
+
+  public:
+	using size_type = std::size_t;
+	using value_type = char;
+	using iterator = char*;
+	using const_iterator = char const*;
+
+	static constexpr size_type npos = std::string_view::npos;
+	static constexpr size_type max_size() noexcept { return N; }
+
+	fixed_string() noexcept { m_chars[0] = '\0'; }
+	explicit fixed_string(std::string_view str) noexcept { assign(str); }
+	// copies only the live chars and terminator
+	fixed_string(fixed_string const& rhs) noexcept { assign(rhs.view()); }
+	fixed_string& operator=(fixed_string const& rhs) noexcept { return assign(rhs.view()); }
+
+	operator std::string_view() const noexcept { return view(); }
+	std::string_view view() const noexcept { return std::string_view(m_chars.data(), m_size); }
+	char const* c_str() const noexcept { return m_chars.data(); }
+	char const* data() const noexcept { return m_chars.data(); }
+	char* data() noexcept { return m_chars.data(); }
+
+	char& operator[](size_type index) noexcept {
+		assert(index < m_size);
+		return m_chars[index];
+	}
+	char operator[](size_type index) const noexcept {
+		assert(index < m_size);
+		return m_chars[index];
+	}
+	char& front() noexcept { return (*this)[0]; }
+	char front() const noexcept { return (*this)[0]; }
+	char& back() noexcept { return (*this)[m_size - 1]; }
+	char back() const noexcept { return (*this)[m_size - 1]; }
+
+	iterator begin() noexcept { return m_chars.data(); }
+	iterator end() noexcept { return m_chars.data() + m_size; }
+	const_iterator begin() const noexcept { return m_chars.data(); }
+	const_iterator end() const noexcept { return m_chars.data() + m_size; }
+
+	bool empty() const noexcept { return m_size == 0; }
+	size_type size() const noexcept { return m_size; }
+	size_type length() const noexcept { return m_size; }
+	constexpr size_type capacity() const noexcept { return N; }
+	size_type spare() const noexcept { return N - m_size; }
+
+	size_type find(std::string_view str, size_type pos = 0) const noexcept { return view().find(str, pos); }
+	size_type find(char ch, size_type pos = 0) const noexcept { return view().find(ch, pos); }
+	size_type rfind(std::string_view str, size_type pos = npos) const noexcept { return view().rfind(str, pos); }
+	size_type rfind(char ch, size_type pos = npos) const noexcept { return view().rfind(ch, pos); }
+	bool contains(std::string_view str) const noexcept { return find(str) != npos; }
+	bool starts_with(std::string_view str) const noexcept { return m_size >= str.size() && view().compare(0, str.size(), str) == 0; }
+	bool ends_with(std::string_view str) const noexcept { return m_size >= str.size() && view().compare(m_size - str.size(), npos, str) == 0; }
+	int compare(std::string_view str) const noexcept { return view().compare(str); }
+
+	void clear() noexcept { set_size(0); }
+	fixed_string& assign(std::string_view str) noexcept;
+	void resize(size_type count, char ch = '\0') noexcept;
+	void push_back(char ch) noexcept { append(ch); }
+	void pop_back() noexcept;
+
+	fixed_string& append(std::string_view str) noexcept;
+	fixed_string& append(char ch) noexcept;
+	fixed_string& append(size_type count, char ch) noexcept;
+	///
+	/// \brief Append the shortest decimal representation of value
+	///
+	template <typename T, typename = enable_if_number<T>>
+	fixed_string& append(T value) noexcept;
+	template <typename T, typename = std::enable_if_t<std::is_floating_point_v<T>>>
+	fixed_string& append(T value, std::chars_format fmt, int precision) noexcept;
+
+	fixed_string& operator+=(std::string_view str) noexcept { return append(str); }
+	fixed_string& operator+=(char ch) noexcept { return append(ch); }
+
+  private:
+	void set_size(size_type size) noexcept {
+		m_size = size;
+		m_chars[m_size] = '\0';
+	}
+	template <typename... Args>
+	fixed_string& append_chars(Args... args) noexcept;
+
+	std::array<char, N + 1> m_chars;
+	size_type m_size = 0;
+};
+
+template <std::size_t N, std::size_t M>
+bool operator==(fixed_string<N> const& lhs, fixed_string<M> const& rhs) noexcept {
+	return lhs.view() == rhs.view();
+}
+template <std::size_t N>
+bool operator==(fixed_string<N> const& lhs, std::string_view rhs) noexcept {
+	return lhs.view() == rhs;
+}
+template <std::size_t N>
+bool operator==(std::string_view lhs, fixed_string<N> const& rhs) noexcept {
+	return lhs == rhs.view();
+}
+template <std::size_t N, std::size_t M>
+bool operator!=(fixed_string<N> const& lhs, fixed_string<M> const& rhs) noexcept {
+	return !(lhs == rhs);
+}
+template <std::size_t N>
+bool operator!=(fixed_string<N> const& lhs, std::string_view rhs) noexcept {
+	return !(lhs == rhs);
+}
+template <std::size_t N>
+bool operator!=(std::string_view lhs, fixed_string<N> const& rhs) noexcept {
+	return !(lhs == rhs);
+}
+template <std::size_t N, std::size_t M>
+bool operator<(fixed_string<N> const& lhs, fixed_string<M> const& rhs) noexcept {
+	return lhs.view() < rhs.view();
+}
+template <std::size_t N>
+bool operator<(fixed_string<N> const& lhs, std::string_view rhs) noexcept {
+	return lhs.view() < rhs;
+}
+template <std::size_t N>
+bool operator<(std::string_view lhs, fixed_string<N> const& rhs) noexcept {
+	return lhs < rhs.view();
+}
+
+// impl
+
+template <std::size_t N>
+fixed_string<N>& fixed_string<N>::assign(std::string_view str) noexcept {
+	assert(str.size() <= N);
+	if (!str.empty()) { std::memmove(m_chars.data(), str.data(), str.size()); }
+	set_size(str.size());
+	return *this;
+}
+template <std::size_t N>
+void fixed_string<N>::resize(size_type count, char ch) noexcept {
+	assert(count <= N);
+	if (count > m_size) { std::memset(m_chars.data() + m_size, ch, count - m_size); }
+	set_size(count);
+}
+template <std::size_t N>
+void fixed_string<N>::pop_back() noexcept {
+	assert(!empty());
+	set_size(m_size - 1);
+}
+template <std::size_t N>
+fixed_string<N>& fixed_string<N>::append(std::string_view str) noexcept {
+	assert(str.size() <= spare());
+	if (!str.empty()) { std::memmove(m_chars.data() + m_size, str.data(), str.size()); }
+	set_size(m_size + str.size());
+	return *this;
+}
+template <std::size_t N>
+fixed_string<N>& fixed_string<N>::append(char ch) noexcept {
+	assert(m_size < N);
+	m_chars[m_size] = ch;
+	set_size(m_size + 1);
+	return *this;
+}
+template <std::size_t N>
+fixed_string<N>& fixed_string<N>::append(size_type count, char ch) noexcept {
+	resize(m_size + count, ch);
+	return *this;
+}
+template <std::size_t N>
+template <typename T, typename>
+fixed_string<N>& fixed_string<N>::append(T value) noexcept {
+	return append_chars(value);
+}
+template <std::size_t N>
+template <typename T, typename>
+fixed_string<N>& fixed_string<N>::append(T value, std::chars_format fmt, int precision) noexcept {
+	return append_chars(value, fmt, precision);
+}
+template <std::size_t N>
+template <typename... Args>
+fixed_string<N>& fixed_string<N>::append_chars(Args... args) noexcept {
+	char* const first = m_chars.data() + m_size;
+	auto const [ptr, ec] = std::to_chars(first, m_chars.data() + N, args...);
+	assert(ec == std::errc{});
+	if (ec == std::errc{}) {
+		set_size(static_cast<size_type>(ptr - m_chars.data()));
+	} else {
+		// [first, last) is unspecified on failure: restore the terminator
+		set_size(m_size);
+	}
+	return *this;
+}
+} // namespace kt
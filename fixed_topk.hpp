@@ -0,0 +1,106 @@
+// KT header-only library
+// Requirements: C++17
+
+#pragma once
+#include "fixed_priority_queue.hpp"
+
+namespace kt {
+namespace detail {
+template <typename Compare>
+struct inverse_compare {
+	Compare comp;
+
+	template <typename T>
+	bool operator()(T const& lhs, T const& rhs) const {
+		return comp(rhs, lhs);
+	}
+};
+} // namespace detail
+
+///
+/// \brief Tracks the K greatest (by Compare) of a stream of values
+/// Kept values form a heap with the smallest at the root, so once full an offer is
+/// a single comparison against threshold() and only admitted values pay for a sift.
+///
+template <typename T, std::size_t K, typename Compare = std::less<T>>
+class fixed_topk {
+  public:
+	using size_type = std::size_t;
+	using value_type = T;
+	using const_iterator = T const*;
+
+	static constexpr size_type max_size() noexcept { return K; }
+
+	fixed_topk() = default;
+	explicit fixed_topk(Compare comp) : m_heap(detail::inverse_compare<Compare>{comp}), m_comp(std::move(comp)) {}
+
+	///
+	/// \brief Smallest kept value: anything not greater is rejected once full()
+	///
+	T const& threshold() const noexcept { return m_heap.top(); }
+	///
+	/// \brief Kept values in heap order
+	///
+	const_iterator begin() const noexcept { return m_heap.begin(); }
+	const_iterator end() const noexcept { return m_heap.end(); }
+
+	bool empty() const noexcept { return m_heap.empty(); }
+	bool full() const noexcept { return !m_heap.has_space(); }
+	size_type size() const noexcept { return m_heap.size(); }
+	constexpr size_type capacity() const noexcept { return K; }
+
+	void clear() noexcept { m_heap.clear(); }
+	///
+	/// \returns Whether t was kept
+	///
+	bool offer(T const& t);
+	///
+	/// \returns Number of values kept from [first, last)
+	///
+	template <typename InputIt>
+	size_type offer(InputIt first, InputIt last);
+	///
+	/// \brief Kept values, greatest first
+	///
+	fixed_vector<T, K> sorted() const;
+
+  private:
+	fixed_priority_queue<T, K, detail::inverse_compare<Compare>> m_heap;
+	Compare m_comp;
+};
+
+// impl
+
+template <typename T, std::size_t K, typename Compare>
+bool fixed_topk<T, K, Compare>::offer(T const& t) {
+	if (!full()) {
+		m_heap.push(t);
+		return true;
+	}
+	if (!m_comp(threshold(), t)) { return false; }
+	m_heap.pop_push(t);
+	return true;
+}
+template <typename T, std::size_t K, typename Compare>
+template <typename InputIt>
+typename fixed_topk<T, K, Compare>::size_type fixed_topk<T, K, Compare>::offer(InputIt first, InputIt last) {
+	size_type ret = 0;
+	for (; first != last && !full(); ++first, ++ret) { m_heap.push(*first); }
+	if (first == last) { return ret; }
+	// threshold only changes on admission: keep a copy hot for the reject loop
+	T limit = threshold();
+	for (; first != last; ++first) {
+		if (!m_comp(limit, *first)) { continue; }
+		m_heap.pop_push(*first);
+		limit = threshold();
+		++ret;
+	}
+	return ret;
+}
+template <typename T, std::size_t K, typename Compare>
+fixed_vector<T, K> fixed_topk<T, K, Compare>::sorted() const {
+	fixed_vector<T, K> ret(begin(), end());
+	std::sort(ret.data(), ret.data() + ret.size(), detail::inverse_compare<Compare>{m_comp});
+	return ret;
+}
+} // namespace kt
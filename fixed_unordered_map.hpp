@@ -0,0 +1,299 @@
+// KT header-only library
+// Requirements: C++17
+
+#pragma once
+#include <tuple>
+#include "fixed_vector.hpp"
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define KT_FIXED_UNORDERED_MAP_SSE2
+#endif
+
+namespace kt {
+namespace detail {
+// 16 control bytes probed at once: bit i of a mask refers to byte i
+struct ctrl_group {
+	static constexpr std::size_t width = 16;
+	static constexpr std::uint8_t empty = 0x80;
+
+#if defined(KT_FIXED_UNORDERED_MAP_SSE2)
+	explicit ctrl_group(std::uint8_t const* ctrl) noexcept : m_bytes(_mm_loadu_si128(reinterpret_cast<__m128i const*>(ctrl))) {}
+
+	std::uint32_t match(std::uint8_t h2) const noexcept {
+		return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(m_bytes, _mm_set1_epi8(static_cast<char>(h2)))));
+	}
+	std::uint32_t match_empty() const noexcept { return static_cast<std::uint32_t>(_mm_movemask_epi8(m_bytes)); }
+
+  private:
+	__m128i m_bytes;
+#else
+	explicit ctrl_group(std::uint8_t const* ctrl) noexcept { std::memcpy(m_bytes, ctrl, width); }
+
+	std::uint32_t match(std::uint8_t h2) const noexcept {
+		std::uint32_t ret = 0;
+		for (std::size_t i = 0; i < width; ++i) { ret |= static_cast<std::uint32_t>(m_bytes[i] == h2) << i; }
+		return ret;
+	}
+	std::uint32_t match_empty() const noexcept { return match(empty); }
+
+  private:
+	std::uint8_t m_bytes[width];
+#endif
+};
+} // namespace detail
+
+///
+/// \brief Open-addressing hash map on inline storage, holding at most N elements
+/// One control byte per slot (empty, or 7 bits of the hash) is probed 16 slots at a time;
+/// slots are linearly probed and erase shifts followers back, so there are no tombstones.
+/// The slot count is the power of two (at least 16) that bounds the load factor to 7/8.
+/// Insertion never moves existing elements; erase may move other elements back into the freed slot.
+///
+template <typename K, typename V, std::size_t N, typename Hash = std::hash<K>, typename KeyEqual = std::equal_to<K>>
+class fixed_unordered_map {
+	static_assert(N > 0, "N must be positive");
+
+  public:
+	using size_type = std::size_t;
+	using key_type = K;
+	using mapped_type = V;
+	using value_type = std::pair<K const, V>;
+
+	template <bool IsConst>
+	class iter_t;
+	using iterator = iter_t<false>;
+	using const_iterator = iter_t<true>;
+
+	static constexpr size_type slot_count = detail::probe_slot_count(N);
+	static constexpr size_type max_size() noexcept { return N; }
+
+	fixed_unordered_map() noexcept { reset_ctrl(); }
+	fixed_unordered_map(fixed_unordered_map&& rhs) noexcept;
+	fixed_unordered_map(fixed_unordered_map const& rhs);
+	fixed_unordered_map& operator=(fixed_unordered_map&& rhs) noexcept;
+	fixed_unordered_map& operator=(fixed_unordered_map const& rhs);
+	~fixed_unordered_map() noexcept { clear(); }
+
+	iterator begin() noexcept { return iterator(this, next_full(0)); }
+	iterator end() noexcept { return iterator(this, slot_count); }
+	const_iterator begin() const noexcept { return const_iterator(this, next_full(0)); }
+	const_iterator end() const noexcept { return const_iterator(this, slot_count); }
+	const_iterator cbegin() const noexcept { return begin(); }
+	const_iterator cend() const noexcept { return end(); }
+
+	bool empty() const noexcept { return m_size == 0; }
+	size_type size() const noexcept { return m_size; }
+	constexpr size_type capacity() const noexcept { return N; }
+	bool has_space() const noexcept { return m_size < N; }
+
+	iterator find(K const& key) noexcept { return iterator(this, find_slot(key)); }
+	const_iterator find(K const& key) const noexcept { return const_iterator(this, find_slot(key)); }
+	bool contains(K const& key) const noexcept { return find_slot(key) != slot_count; }
+	V& operator[](K const& key) { return try_emplace(key).first->second; }
+
+	void clear() noexcept;
+	template <typename... Args>
+	std::pair<iterator, bool> try_emplace(K const& key, Args&&... args);
+	std::pair<iterator, bool> insert(value_type const& value) { return try_emplace(value.first, value.second); }
+	template <typename U>
+	std::pair<iterator, bool> insert_or_assign(K const& key, U&& value);
+	///
+	/// \returns Number of elements erased (0 or 1)
+	///
+	size_type erase(K const& key);
+
+  private:
+	using storage_t = std::array<std::aligned_storage_t<sizeof(value_type), alignof(value_type)>, slot_count>;
+	static constexpr size_type mask = slot_count - 1;
+
+	static std::uint64_t hash(K const& key) noexcept { return detail::hash_mix(static_cast<std::uint64_t>(Hash{}(key))); }
+	static size_type home(std::uint64_t h) noexcept { return static_cast<size_type>(h >> 7) & mask; }
+	static std::uint8_t h2(std::uint64_t h) noexcept { return static_cast<std::uint8_t>(h & 0x7f); }
+
+	value_type* slot(size_type index) noexcept { return std::launder(reinterpret_cast<value_type*>(&m_slots[index])); }
+	value_type const* slot(size_type index) const noexcept { return std::launder(reinterpret_cast<value_type const*>(&m_slots[index])); }
+	bool full(size_type index) const noexcept { return m_ctrl[index] != detail::ctrl_group::empty; }
+	void set_ctrl(size_type index, std::uint8_t ctrl) noexcept;
+	void reset_ctrl() noexcept;
+	size_type next_full(size_type index) const noexcept;
+	size_type find_slot(K const& key) const noexcept;
+	template <typename Map>
+	void clone(Map&& rhs);
+
+	storage_t m_slots;
+	// mirrors the first group after the end so unaligned group loads wrap around
+	std::array<std::uint8_t, slot_count + detail::ctrl_group::width> m_ctrl;
+	size_type m_size = 0;
+
+	template <bool IsConst>
+	friend class iter_t;
+};
+
+// impl
+
+template <typename K, typename V, std::size_t N, typename Hash, typename KeyEqual>
+template <bool IsConst>
+class fixed_unordered_map<K, V, N, Hash, KeyEqual>::iter_t {
+	using map_t = std::conditional_t<IsConst, fixed_unordered_map const, fixed_unordered_map>;
+
+  public:
+	using iterator_category = std::forward_iterator_tag;
+	using value_type = typename fixed_unordered_map::value_type;
+	using difference_type = std::ptrdiff_t;
+	using pointer = std::conditional_t<IsConst, value_type const*, value_type*>;
+	using reference = std::conditional_t<IsConst, value_type const&, value_type&>;
+
+	iter_t() = default;
+	// Implicit conversion to const iter_t
+	operator iter_t<true>() const noexcept { return iter_t<true>(m_map, m_index); }
+
+	reference operator*() const noexcept { return *m_map->slot(m_index); }
+	pointer operator->() const noexcept { return m_map->slot(m_index); }
+
+	iter_t& operator++() noexcept {
+		m_index = m_map->next_full(m_index + 1);
+		return *this;
+	}
+	iter_t operator++(int) noexcept {
+		auto ret = *this;
+		++(*this);
+		return ret;
+	}
+
+	friend bool operator==(iter_t const& lhs, iter_t const& rhs) noexcept { return lhs.m_map == rhs.m_map && lhs.m_index == rhs.m_index; }
+	friend bool operator!=(iter_t const& lhs, iter_t const& rhs) noexcept { return !(lhs == rhs); }
+
+  private:
+	iter_t(map_t* map, size_type index) noexcept : m_map(map), m_index(index) {}
+
+	map_t* m_map{};
+	size_type m_index{};
+
+	friend class fixed_unordered_map;
+};
+
+template <typename K, typename V, std::size_t N, typename Hash, typename KeyEqual>
+fixed_unordered_map<K, V, N, Hash, KeyEqual>::fixed_unordered_map(fixed_unordered_map&& rhs) noexcept {
+	reset_ctrl();
+	clone(std::move(rhs));
+	rhs.clear();
+}
+template <typename K, typename V, std::size_t N, typename Hash, typename KeyEqual>
+fixed_unordered_map<K, V, N, Hash, KeyEqual>::fixed_unordered_map(fixed_unordered_map const& rhs) {
+	reset_ctrl();
+	clone(rhs);
+}
+template <typename K, typename V, std::size_t N, typename Hash, typename KeyEqual>
+fixed_unordered_map<K, V, N, Hash, KeyEqual>& fixed_unordered_map<K, V, N, Hash, KeyEqual>::operator=(fixed_unordered_map&& rhs) noexcept {
+	if (&rhs != this) {
+		clear();
+		clone(std::move(rhs));
+		rhs.clear();
+	}
+	return *this;
+}
+template <typename K, typename V, std::size_t N, typename Hash, typename KeyEqual>
+fixed_unordered_map<K, V, N, Hash, KeyEqual>& fixed_unordered_map<K, V, N, Hash, KeyEqual>::operator=(fixed_unordered_map const& rhs) {
+	if (&rhs != this) {
+		clear();
+		clone(rhs);
+	}
+	return *this;
+}
+template <typename K, typename V, std::size_t N, typename Hash, typename KeyEqual>
+void fixed_unordered_map<K, V, N, Hash, KeyEqual>::clear() noexcept {
+	if constexpr (!std::is_trivially_destructible_v<value_type>) {
+		for (size_type i = next_full(0); i < slot_count; i = next_full(i + 1)) { slot(i)->~value_type(); }
+	}
+	reset_ctrl();
+	m_size = 0;
+}
+template <typename K, typename V, std::size_t N, typename Hash, typename KeyEqual>
+template <typename... Args>
+std::pair<typename fixed_unordered_map<K, V, N, Hash, KeyEqual>::iterator, bool> fixed_unordered_map<K, V, N, Hash, KeyEqual>::try_emplace(K const& key,
+																																		 Args&&... args) {
+	std::uint64_t const h = hash(key);
+	std::uint8_t const tag = h2(h);
+	for (size_type pos = home(h);; pos = (pos + detail::ctrl_group::width) & mask) {
+		detail::ctrl_group const group(&m_ctrl[pos]);
+		for (std::uint32_t match = group.match(tag); match != 0; match &= match - 1) {
+			size_type const index = (pos + static_cast<size_type>(detail::countr_zero(match))) & mask;
+			if (KeyEqual{}(slot(index)->first, key)) { return {iterator(this, index), false}; }
+		}
+		if (std::uint32_t const empty = group.match_empty()) {
+			// linear probing: the first empty slot after home ends the probe sequence and takes the new element
+			assert(has_space());
+			size_type const index = (pos + static_cast<size_type>(detail::countr_zero(empty))) & mask;
+			new (&m_slots[index]) value_type(std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple(std::forward<Args>(args)...));
+			set_ctrl(index, tag);
+			++m_size;
+			return {iterator(this, index), true};
+		}
+	}
+}
+template <typename K, typename V, std::size_t N, typename Hash, typename KeyEqual>
+template <typename U>
+std::pair<typename fixed_unordered_map<K, V, N, Hash, KeyEqual>::iterator, bool> fixed_unordered_map<K, V, N, Hash, KeyEqual>::insert_or_assign(K const& key,
+																																			U&& value) {
+	auto ret = try_emplace(key, std::forward<U>(value));
+	if (!ret.second) { ret.first->second = std::forward<U>(value); }
+	return ret;
+}
+template <typename K, typename V, std::size_t N, typename Hash, typename KeyEqual>
+typename fixed_unordered_map<K, V, N, Hash, KeyEqual>::size_type fixed_unordered_map<K, V, N, Hash, KeyEqual>::erase(K const& key) {
+	size_type const pos = find_slot(key);
+	if (pos == slot_count) { return 0; }
+	slot(pos)->~value_type();
+	auto const is_full = [this](size_type index) { return full(index); };
+	auto const home_of = [this](size_type index) { return home(hash(slot(index)->first)); };
+	auto const move = [this](size_type from, size_type to) {
+		new (&m_slots[to]) value_type(std::move(*slot(from)));
+		slot(from)->~value_type();
+		set_ctrl(to, m_ctrl[from]);
+	};
+	set_ctrl(detail::backward_shift(pos, mask, is_full, home_of, move), detail::ctrl_group::empty);
+	--m_size;
+	return 1;
+}
+template <typename K, typename V, std::size_t N, typename Hash, typename KeyEqual>
+void fixed_unordered_map<K, V, N, Hash, KeyEqual>::set_ctrl(size_type index, std::uint8_t ctrl) noexcept {
+	m_ctrl[index] = ctrl;
+	if (index < detail::ctrl_group::width) { m_ctrl[slot_count + index] = ctrl; }
+}
+template <typename K, typename V, std::size_t N, typename Hash, typename KeyEqual>
+void fixed_unordered_map<K, V, N, Hash, KeyEqual>::reset_ctrl() noexcept {
+	std::memset(m_ctrl.data(), detail::ctrl_group::empty, m_ctrl.size());
+}
+template <typename K, typename V, std::size_t N, typename Hash, typename KeyEqual>
+typename fixed_unordered_map<K, V, N, Hash, KeyEqual>::size_type fixed_unordered_map<K, V, N, Hash, KeyEqual>::next_full(size_type index) const noexcept {
+	while (index < slot_count && !full(index)) { ++index; }
+	return index;
+}
+template <typename K, typename V, std::size_t N, typename Hash, typename KeyEqual>
+typename fixed_unordered_map<K, V, N, Hash, KeyEqual>::size_type fixed_unordered_map<K, V, N, Hash, KeyEqual>::find_slot(K const& key) const noexcept {
+	std::uint64_t const h = hash(key);
+	std::uint8_t const tag = h2(h);
+	for (size_type pos = home(h);; pos = (pos + detail::ctrl_group::width) & mask) {
+		detail::ctrl_group const group(&m_ctrl[pos]);
+		for (std::uint32_t match = group.match(tag); match != 0; match &= match - 1) {
+			size_type const index = (pos + static_cast<size_type>(detail::countr_zero(match))) & mask;
+			if (KeyEqual{}(slot(index)->first, key)) { return index; }
+		}
+		if (group.match_empty() != 0) { return slot_count; }
+	}
+}
+template <typename K, typename V, std::size_t N, typename Hash, typename KeyEqual>
+template <typename Map>
+void fixed_unordered_map<K, V, N, Hash, KeyEqual>::clone(Map&& rhs) {
+	// same slot count and hash: every element keeps its slot
+	for (size_type i = rhs.next_full(0); i < slot_count; i = rhs.next_full(i + 1)) {
+		if constexpr (std::is_rvalue_reference_v<Map&&>) {
+			new (&m_slots[i]) value_type(std::move(*rhs.slot(i)));
+		} else {
+			new (&m_slots[i]) value_type(*rhs.slot(i));
+		}
+	}
+	m_ctrl = rhs.m_ctrl;
+	m_size = rhs.m_size;
+}
+} // namespace kt
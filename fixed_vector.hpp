@@ -2,16 +2,25 @@
 // Requirements: C++17
 
 #pragma once
+#include <algorithm>
 #include <array>
 #include <cassert>
 #include <cstddef>
+#include <cstdint>
 #include <cstring>
+#include <functional>
 #include <initializer_list>
 #include <iterator>
 #include <new>
 #include <type_traits>
+#include <utility>
 
 namespace kt {
+namespace detail {
+// Grants bulk writers raw access to a fixed_vector's storage and size
+struct fixed_vector_access;
+} // namespace detail
+
 ///
 /// \brief vector-like container using bytearray as storage
 /// Refer to std::vector for API documentation
@@ -85,10 +94,32 @@ class fixed_vector {
 	iterator emplace(const_iterator pos, Args&&... args);
 	iterator erase(const_iterator pos);
 	iterator erase(const_iterator first, const_iterator last);
+	///
+	/// \brief Erase element at pos by moving back() into it; does not preserve order
+	///
+	iterator erase_unordered(const_iterator pos);
+	///
+	/// \brief Erase all elements satisfying pred in a single pass; does not preserve order
+	/// \returns Number of elements erased
+	///
+	template <typename Pred>
+	size_type erase_unordered_if(Pred pred);
+	///
+	/// \brief Erase elements at each index in [first, last) in a single pass
+	/// Indices must be unique and sorted in ascending order
+	/// \returns Number of elements erased
+	///
+	template <typename InputIt, typename = enable_if_iterator<InputIt>>
+	size_type erase_indices(InputIt first, InputIt last);
 	void push_back(T&& t) { emplace_back(std::move(t)); }
 	void push_back(T const& t) { emplace_back(t); }
 	template <typename... Args>
 	T& emplace_back(Args&&... args);
+	///
+	/// \brief Append t if cond is true; requires space for one element regardless of cond
+	/// Trivial types are always stored and the size bumped by cond, avoiding a branch
+	///
+	bool push_back_if(bool cond, T const& t);
 	void pop_back() noexcept;
 	void resize(size_type count, T const& t = {}) noexcept;
 
@@ -102,21 +133,177 @@ class fixed_vector {
 
 	void clone(fixed_vector&& rhs) noexcept;
 	void clone(fixed_vector const& rhs) noexcept;
+	void truncate(size_type count) noexcept;
 
 	storage_t m_storage;
 	size_type m_size = 0;
 
 	template <bool IsConst>
 	friend class iter_t;
+	friend struct detail::fixed_vector_access;
 };
 
 template <typename T, std::size_t N>
 bool operator==(fixed_vector<T, N> const& lhs, fixed_vector<T, N> const& rhs) noexcept;
 template <typename T, std::size_t N>
 bool operator!=(fixed_vector<T, N> const& lhs, fixed_vector<T, N> const& rhs) noexcept;
+template <typename T, std::size_t N>
+bool operator<(fixed_vector<T, N> const& lhs, fixed_vector<T, N> const& rhs) noexcept;
+template <typename T, std::size_t N>
+bool operator>(fixed_vector<T, N> const& lhs, fixed_vector<T, N> const& rhs) noexcept;
+template <typename T, std::size_t N>
+bool operator<=(fixed_vector<T, N> const& lhs, fixed_vector<T, N> const& rhs) noexcept;
+template <typename T, std::size_t N>
+bool operator>=(fixed_vector<T, N> const& lhs, fixed_vector<T, N> const& rhs) noexcept;
+#if defined(__cpp_lib_three_way_comparison)
+template <typename T, std::size_t N>
+auto operator<=>(fixed_vector<T, N> const& lhs, fixed_vector<T, N> const& rhs) noexcept;
+#endif
+
+///
+/// \brief Erase all elements satisfying pred, preserving order
+/// \returns Number of elements erased
+///
+template <typename T, std::size_t N, typename Pred>
+std::size_t erase_if(fixed_vector<T, N>& vec, Pred pred);
+///
+/// \brief Erase all elements equal to value, preserving order
+/// \returns Number of elements erased
+///
+template <typename T, std::size_t N, typename U>
+std::size_t erase(fixed_vector<T, N>& vec, U const& value);
 
 // impl
 
+namespace detail {
+// Elements written through storage() become part of the vector by set_size(), without being constructed first (hence trivial types only)
+struct fixed_vector_access {
+	// First slot of the storage, valid even while vec is empty
+	template <typename T, std::size_t N>
+	static T* storage(fixed_vector<T, N>& vec) noexcept {
+		static_assert(std::is_trivial_v<T>, "raw storage access is only for trivial types");
+		return reinterpret_cast<T*>(vec.m_storage.data());
+	}
+	template <typename T, std::size_t N>
+	static void set_size(fixed_vector<T, N>& vec, std::size_t size) noexcept {
+		static_assert(std::is_trivial_v<T>, "raw storage access is only for trivial types");
+		assert(size <= N);
+		vec.m_size = size;
+	}
+};
+
+// Element types whose equality is exactly bytewise equality
+// Restricted to scalars: a class type may define operator== over a subset or a normalization of its bytes
+template <typename T>
+constexpr bool is_bytewise_equal_v = (std::is_integral_v<T> || std::is_enum_v<T> || std::is_pointer_v<T>) && std::has_unique_object_representations_v<T>;
+// Element types whose lexicographic order is exactly memcmp order
+template <typename T>
+constexpr bool is_bytewise_ordered_v = std::is_same_v<T, unsigned char> || std::is_same_v<T, std::byte> || (std::is_same_v<T, char> && !std::is_signed_v<char>);
+
+template <typename T>
+int compare_three_way(T const* lhs, std::size_t lsize, T const* rhs, std::size_t rsize) noexcept {
+	std::size_t const common = lsize < rsize ? lsize : rsize;
+	if constexpr (is_bytewise_ordered_v<T>) {
+		if (common > 0) {
+			if (int const ret = std::memcmp(lhs, rhs, common)) { return ret; }
+		}
+	} else {
+		for (std::size_t i = 0; i < common; ++i) {
+			if (lhs[i] < rhs[i]) { return -1; }
+			if (rhs[i] < lhs[i]) { return 1; }
+		}
+	}
+	return lsize < rsize ? -1 : (rsize < lsize ? 1 : 0);
+}
+
+constexpr std::uint64_t rotl(std::uint64_t x, int r) noexcept { return (x << r) | (x >> (64 - r)); }
+constexpr std::uint64_t hash_mix(std::uint64_t h) noexcept {
+	h = (h ^ (h >> 30)) * 0xbf58476d1ce4e5b9ULL;
+	h = (h ^ (h >> 27)) * 0x94d049bb133111ebULL;
+	return h ^ (h >> 31);
+}
+inline std::uint64_t load_u64(unsigned char const* bytes) noexcept {
+	std::uint64_t ret;
+	std::memcpy(&ret, bytes, sizeof(ret));
+	return ret;
+}
+
+///
+/// \brief Non-cryptographic 64-bit hash of a byte range
+/// Consumes 16 bytes per round on two independent lanes, then finalizes with a splitmix64 avalanche
+///
+inline std::uint64_t hash_bytes(void const* data, std::size_t size, std::uint64_t seed = 0) noexcept {
+	constexpr std::uint64_t k0 = 0x9e3779b97f4a7c15ULL;
+	constexpr std::uint64_t k1 = 0xc2b2ae3d27d4eb4fULL;
+	constexpr std::uint64_t k2 = 0x165667b19e3779f9ULL;
+	auto const* bytes = static_cast<unsigned char const*>(data);
+	std::uint64_t a = seed ^ k0;
+	std::uint64_t b = static_cast<std::uint64_t>(size) * k1;
+	for (; size >= 16; bytes += 16, size -= 16) {
+		a = rotl(a ^ (load_u64(bytes) * k1), 31) * k0;
+		b = rotl(b ^ (load_u64(bytes + 8) * k2), 29) * k1;
+	}
+	if (size >= 8) {
+		a = rotl(a ^ (load_u64(bytes) * k1), 31) * k0;
+		bytes += 8;
+		size -= 8;
+	}
+	if (size > 0) {
+		std::uint64_t tail{};
+		std::memcpy(&tail, bytes, size);
+		b = rotl(b ^ (tail * k2), 29) * k1;
+	}
+	return hash_mix(a ^ rotl(b, 32));
+}
+inline int countr_zero(std::uint64_t x) noexcept {
+	if (x == 0) { return 64; }
+#if defined(__GNUC__) || defined(__clang__)
+	return __builtin_ctzll(x);
+#else
+	int ret = 0;
+	for (; (x & 1) == 0; x >>= 1) { ++ret; }
+	return ret;
+#endif
+}
+inline int popcount(std::uint64_t x) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+	return __builtin_popcountll(x);
+#else
+	x = x - ((x >> 1) & 0x5555555555555555ULL);
+	x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+	x = (x + (x >> 4)) & 0x0f0f0f0f0f0f0f0fULL;
+	return static_cast<int>((x * 0x0101010101010101ULL) >> 56);
+#endif
+}
+inline void prefetch([[maybe_unused]] void const* ptr) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+	__builtin_prefetch(ptr);
+#endif
+}
+constexpr std::size_t ceil_pow2(std::size_t n) noexcept {
+	std::size_t ret = 1;
+	while (ret < n) { ret *= 2; }
+	return ret;
+}
+
+// Open-addressing helpers shared by the linearly probed tables (fixed_unordered_map, fixed_lru)
+// Slot count for up to n elements: the power of two (at least 16) that bounds the load factor to 7/8
+constexpr std::size_t probe_slot_count(std::size_t n) noexcept { return ceil_pow2(n + n / 7 + 1) < 16 ? 16 : ceil_pow2(n + n / 7 + 1); }
+// Backward-shift erase over mask + 1 slots: pull each follower whose probe sequence covers the hole into it
+// full(pos) tests occupancy, home(pos) is the home slot of the element at pos, move(from, to) relocates it
+// Returns the final hole, which the caller marks empty
+template <typename Full, typename Home, typename Move>
+std::size_t backward_shift(std::size_t hole, std::size_t mask, Full full, Home home, Move move) {
+	for (std::size_t pos = (hole + 1) & mask; full(pos); pos = (pos + 1) & mask) {
+		if (((pos - home(pos)) & mask) >= ((pos - hole) & mask)) {
+			move(pos, hole);
+			hole = pos;
+		}
+	}
+	return hole;
+}
+} // namespace detail
+
 template <typename T, std::size_t N>
 template <bool IsConst>
 class fixed_vector<T, N>::iter_t {
@@ -240,7 +427,7 @@ void fixed_vector<T, N>::clear() noexcept {
 }
 template <typename T, std::size_t N>
 typename fixed_vector<T, N>::iterator fixed_vector<T, N>::insert(const_iterator pos, size_type count, T const& t) {
-	if (count == 0) { return pos; }
+	if (count == 0) { return iterator(&m_storage, pos.m_index); }
 	size_type const ret = pos.m_index;
 	for (; count > 0; --count) { pos = emplace(pos, t); }
 	return iterator(&m_storage, ret);
@@ -248,9 +435,18 @@ typename fixed_vector<T, N>::iterator fixed_vector<T, N>::insert(const_iterator
 template <typename T, std::size_t N>
 template <typename InputIt, typename>
 typename fixed_vector<T, N>::iterator fixed_vector<T, N>::insert(const_iterator pos, InputIt first, InputIt last) {
-	if (std::distance(first, last) == 0) { return pos; }
 	size_type const ret = pos.m_index;
-	for (; first != last; ++first) { pos = emplace(pos, *first); }
+	if constexpr (std::is_pointer_v<InputIt> && std::is_same_v<std::remove_cv_t<std::remove_pointer_t<InputIt>>, T> && std::is_trivial_v<T>) {
+		// bulk append
+		if (pos.m_index == m_size) {
+			auto const count = static_cast<size_type>(last - first);
+			assert(m_size + count <= capacity());
+			if (count > 0) { std::memcpy(&m_storage[m_size], first, count * sizeof(T)); }
+			m_size += count;
+			return iterator(&m_storage, ret);
+		}
+	}
+	for (; first != last; ++first) { pos = emplace(pos, *first) + 1; }
 	return iterator(&m_storage, ret);
 }
 template <typename T, std::size_t N>
@@ -265,17 +461,26 @@ typename fixed_vector<T, N>::iterator fixed_vector<T, N>::emplace(const_iterator
 		emplace_back(std::forward<Args>(u)...);
 		return iterator(&m_storage, m_size - 1);
 	}
-	using std::swap;
-	size_type idx = pos.m_index;
-	T temp{};
-	for (; idx < m_size; ++idx) { swap(temp, at(idx)); }
-	emplace_back(std::move(temp));
-	at(pos.m_index) = T{std::forward<Args>(u)...};
-	return iterator(&m_storage, pos.m_index);
+	size_type const idx = pos.m_index;
+	T* const ptr = cast<T*>(m_storage, 0);
+	// construct first: args may refer to elements about to be shifted
+	T t{std::forward<Args>(u)...};
+	if constexpr (std::is_trivial_v<T>) {
+		std::memmove(ptr + idx + 1, ptr + idx, (m_size - idx) * sizeof(T));
+		ptr[idx] = t;
+		++m_size;
+	} else {
+		emplace_back(std::move(back()));
+		std::move_backward(ptr + idx, ptr + m_size - 2, ptr + m_size - 1);
+		ptr[idx] = std::move(t);
+	}
+	return iterator(&m_storage, idx);
 }
 template <typename T, std::size_t N>
 typename fixed_vector<T, N>::iterator fixed_vector<T, N>::erase(const_iterator pos) {
-	for (size_type idx = pos.m_index; idx < m_size - 1; ++idx) { at(idx) = std::move(at(idx + 1)); }
+	assert(pos.m_index < m_size);
+	T* const ptr = cast<T*>(m_storage, 0);
+	std::move(ptr + pos.m_index + 1, ptr + m_size, ptr + pos.m_index);
 	pop_back();
 	return iterator(&m_storage, pos.m_index);
 }
@@ -283,13 +488,57 @@ template <typename T, std::size_t N>
 typename fixed_vector<T, N>::iterator fixed_vector<T, N>::erase(const_iterator first, const_iterator last) {
 	auto const first_idx = first.m_index;
 	if (last.m_index - first_idx == 0) { return iterator(&m_storage, last.m_index); }
-	// shift range to end by moving end to middle
-	while (last.m_index < m_size) { at(first.m_index++) = std::move(at(last.m_index++)); }
-	// pop back till range is empty
-	while (m_size > first.m_index) { pop_back(); }
+	// shift range to end by moving end to middle, then destroy the moved-from tail
+	T* const ptr = cast<T*>(m_storage, 0);
+	T* const tail = std::move(ptr + last.m_index, ptr + m_size, ptr + first_idx);
+	truncate(static_cast<size_type>(tail - ptr));
 	return iterator(&m_storage, first_idx);
 }
 template <typename T, std::size_t N>
+typename fixed_vector<T, N>::iterator fixed_vector<T, N>::erase_unordered(const_iterator pos) {
+	assert(pos.m_index < m_size);
+	if (pos.m_index + 1 < m_size) { at(pos.m_index) = std::move(back()); }
+	pop_back();
+	return iterator(&m_storage, pos.m_index);
+}
+template <typename T, std::size_t N>
+template <typename Pred>
+typename fixed_vector<T, N>::size_type fixed_vector<T, N>::erase_unordered_if(Pred pred) {
+	size_type const prev = m_size;
+	size_type lo = 0;
+	size_type hi = m_size;
+	// each element is tested once: matches at the front are filled with survivors from the back
+	while (true) {
+		while (lo < hi && !pred(at(lo))) { ++lo; }
+		if (lo == hi) { break; }
+		while (hi - 1 > lo && pred(at(hi - 1))) { --hi; }
+		if (hi - 1 == lo) { break; }
+		at(lo++) = std::move(at(--hi));
+	}
+	truncate(lo);
+	return prev - lo;
+}
+template <typename T, std::size_t N>
+template <typename InputIt, typename>
+typename fixed_vector<T, N>::size_type fixed_vector<T, N>::erase_indices(InputIt first, InputIt last) {
+	if (first == last) { return 0; }
+	T* const ptr = cast<T*>(m_storage, 0);
+	auto dst = static_cast<size_type>(*first);
+	auto src = dst;
+	for (; first != last; ++first) {
+		auto const idx = static_cast<size_type>(*first);
+		assert(idx >= src && idx < m_size);
+		std::move(ptr + src, ptr + idx, ptr + dst);
+		dst += idx - src;
+		src = idx + 1;
+	}
+	std::move(ptr + src, ptr + m_size, ptr + dst);
+	dst += m_size - src;
+	size_type const ret = m_size - dst;
+	truncate(dst);
+	return ret;
+}
+template <typename T, std::size_t N>
 template <typename... Args>
 T& fixed_vector<T, N>::emplace_back(Args&&... args) {
 	assert(has_space());
@@ -298,6 +547,17 @@ T& fixed_vector<T, N>::emplace_back(Args&&... args) {
 	return *t;
 }
 template <typename T, std::size_t N>
+bool fixed_vector<T, N>::push_back_if(bool cond, T const& t) {
+	assert(has_space());
+	if constexpr (std::is_trivial_v<T>) {
+		new (&m_storage[m_size]) T(t);
+		m_size += static_cast<size_type>(cond);
+	} else {
+		if (cond) { emplace_back(t); }
+	}
+	return cond;
+}
+template <typename T, std::size_t N>
 void fixed_vector<T, N>::pop_back() noexcept {
 	assert(!empty());
 	if constexpr (!std::is_trivial_v<T>) {
@@ -312,6 +572,14 @@ void fixed_vector<T, N>::resize(size_type count, T const& t) noexcept {
 	while (count > m_size) { push_back(t); }
 }
 template <typename T, std::size_t N>
+void fixed_vector<T, N>::truncate(size_type count) noexcept {
+	assert(count <= m_size);
+	if constexpr (!std::is_trivial_v<T>) {
+		for (size_type i = count; i < m_size; ++i) { cast<T*>(m_storage, i)->~T(); }
+	}
+	m_size = count;
+}
+template <typename T, std::size_t N>
 void fixed_vector<T, N>::clone(fixed_vector&& rhs) noexcept {
 	if constexpr (std::is_trivial_v<T>) {
 		std::memcpy(m_storage.data(), rhs.m_storage.data(), rhs.size() * sizeof(T));
@@ -333,13 +601,74 @@ void fixed_vector<T, N>::clone(fixed_vector const& rhs) noexcept {
 template <typename T, std::size_t N>
 bool operator==(fixed_vector<T, N> const& lhs, fixed_vector<T, N> const& rhs) noexcept {
 	if (lhs.size() != rhs.size()) { return false; }
-	for (typename fixed_vector<T, N>::size_type i = 0; i < lhs.size(); ++i) {
-		if (lhs[i] != rhs[i]) { return false; }
+	if (lhs.empty()) { return true; }
+	T const* l = lhs.data();
+	T const* r = rhs.data();
+	if constexpr (detail::is_bytewise_equal_v<T>) {
+		return std::memcmp(l, r, lhs.size() * sizeof(T)) == 0;
+	} else {
+		for (typename fixed_vector<T, N>::size_type i = 0; i < lhs.size(); ++i) {
+			if (l[i] != r[i]) { return false; }
+		}
+		return true;
 	}
-	return true;
 }
 template <typename T, std::size_t N>
 bool operator!=(fixed_vector<T, N> const& lhs, fixed_vector<T, N> const& rhs) noexcept {
 	return !(lhs == rhs);
 }
+template <typename T, std::size_t N>
+bool operator<(fixed_vector<T, N> const& lhs, fixed_vector<T, N> const& rhs) noexcept {
+	return detail::compare_three_way(lhs.data(), lhs.size(), rhs.data(), rhs.size()) < 0;
+}
+template <typename T, std::size_t N>
+bool operator>(fixed_vector<T, N> const& lhs, fixed_vector<T, N> const& rhs) noexcept {
+	return rhs < lhs;
+}
+template <typename T, std::size_t N>
+bool operator<=(fixed_vector<T, N> const& lhs, fixed_vector<T, N> const& rhs) noexcept {
+	return !(rhs < lhs);
+}
+template <typename T, std::size_t N>
+bool operator>=(fixed_vector<T, N> const& lhs, fixed_vector<T, N> const& rhs) noexcept {
+	return !(lhs < rhs);
+}
+#if defined(__cpp_lib_three_way_comparison)
+template <typename T, std::size_t N>
+auto operator<=>(fixed_vector<T, N> const& lhs, fixed_vector<T, N> const& rhs) noexcept {
+	if constexpr (detail::is_bytewise_ordered_v<T>) {
+		return detail::compare_three_way(lhs.data(), lhs.size(), rhs.data(), rhs.size()) <=> 0;
+	} else {
+		return std::lexicographical_compare_three_way(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+	}
+}
+#endif
+template <typename T, std::size_t N, typename Pred>
+std::size_t erase_if(fixed_vector<T, N>& vec, Pred pred) {
+	T* const first = vec.data();
+	T* const last = first + vec.size();
+	auto const ret = static_cast<std::size_t>(last - std::remove_if(first, last, pred));
+	vec.erase(vec.end() - static_cast<std::ptrdiff_t>(ret), vec.end());
+	return ret;
+}
+template <typename T, std::size_t N, typename U>
+std::size_t erase(fixed_vector<T, N>& vec, U const& value) {
+	return erase_if(vec, [&value](T const& t) { return t == value; });
+}
 } // namespace kt
+
+namespace std {
+template <typename T, std::size_t N>
+struct hash<kt::fixed_vector<T, N>> {
+	std::size_t operator()(kt::fixed_vector<T, N> const& vec) const noexcept {
+		// hashing bytes is only consistent with operator== where equality is bytewise
+		if constexpr (kt::detail::is_bytewise_equal_v<T>) {
+			return static_cast<std::size_t>(kt::detail::hash_bytes(vec.data(), vec.size() * sizeof(T)));
+		} else {
+			std::uint64_t ret = kt::detail::hash_mix(static_cast<std::uint64_t>(vec.size()));
+			for (T const& t : vec) { ret = kt::detail::hash_mix(ret ^ static_cast<std::uint64_t>(std::hash<T>{}(t))); }
+			return static_cast<std::size_t>(ret);
+		}
+	}
+};
+} // namespace std
@@ -0,0 +1,376 @@
+// KT header-only library
+// Requirements: C++17
+
+#pragma once
+#include <bitset>
+#include <memory>
+#include "fixed_vector.hpp"
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define KT_FIXED_VECTOR_AVX2
+#endif
+
+///
+/// \brief Opt-in algorithms over fixed_vector: sorted set operations, stream compaction, partitioning and gather / scatter
+/// All work on contiguous storage through data() and append to destination fixed_vectors with capacity checks
+///
+namespace kt {
+///
+/// \brief Erase all but the first of each run of equivalent consecutive elements
+/// \returns Number of elements erased
+///
+template <typename T, std::size_t N, typename BinaryPred = std::equal_to<>>
+std::size_t unique(fixed_vector<T, N>& vec, BinaryPred pred = {});
+
+// Sorted range algorithms: inputs must be sorted by comp; results are appended to out
+// Capacity of out is asserted like push_back
+
+///
+/// \brief Append the stable merge of lhs and rhs to out
+///
+template <typename T, std::size_t N, std::size_t M, std::size_t O, typename Compare = std::less<>>
+void merge_into(fixed_vector<T, N> const& lhs, fixed_vector<T, M> const& rhs, fixed_vector<T, O>& out, Compare comp = {});
+///
+/// \brief Append the sorted union of lhs and rhs to out
+///
+template <typename T, std::size_t N, std::size_t M, std::size_t O, typename Compare = std::less<>>
+void set_union(fixed_vector<T, N> const& lhs, fixed_vector<T, M> const& rhs, fixed_vector<T, O>& out, Compare comp = {});
+///
+/// \brief Append the sorted intersection of lhs and rhs to out
+/// Switches to galloping search through the larger input when sizes are heavily skewed
+///
+template <typename T, std::size_t N, std::size_t M, std::size_t O, typename Compare = std::less<>>
+void set_intersection(fixed_vector<T, N> const& lhs, fixed_vector<T, M> const& rhs, fixed_vector<T, O>& out, Compare comp = {});
+///
+/// \brief Append the elements of lhs not present in rhs to out
+///
+template <typename T, std::size_t N, std::size_t M, std::size_t O, typename Compare = std::less<>>
+void set_difference(fixed_vector<T, N> const& lhs, fixed_vector<T, M> const& rhs, fixed_vector<T, O>& out, Compare comp = {});
+
+///
+/// \brief Append each element of [first, last) satisfying pred to dst
+/// Uses branchless push_back_if while dst has spare capacity
+/// \returns Number of elements appended
+///
+template <typename InputIt, typename T, std::size_t N, typename Pred>
+std::size_t compact_into(InputIt first, InputIt last, fixed_vector<T, N>& dst, Pred pred);
+///
+/// \brief Append each element t of src with comp(t, bound) to dst, preserving order
+/// Built with AVX2, int32_t / uint32_t / float compared by std::less or std::greater are tested and compacted
+/// 8 lanes per step through a permutation table; other element types and comparisons use the loop above
+/// \returns Number of elements appended
+///
+template <typename T, std::size_t M, std::size_t N, typename Compare>
+std::size_t compact_into(fixed_vector<T, M> const& src, fixed_vector<T, N>& dst, Compare comp, typename fixed_vector<T, M>::value_type const& bound);
+///
+/// \brief Scatter [first, last) into K partitions by key_fn, which must return an index in [0, K)
+/// Trivial types are staged in a cache line per partition and flushed to dst in bulk
+/// Elements that do not fit are dropped
+/// \returns Set of partitions that overflowed
+///
+template <std::size_t K, typename InputIt, typename KeyFn, typename T, std::size_t N>
+std::bitset<K> partition_into(InputIt first, InputIt last, KeyFn key_fn, fixed_vector<T, N> (&dst)[K]);
+
+///
+/// \brief Append table[i] to out for each index i in indices, prefetching the entry distance indices ahead
+/// Pass distance = 0 to disable prefetching for tables that already fit in cache
+///
+template <typename I, std::size_t N, typename RandomIt, typename T, std::size_t M>
+void gather(fixed_vector<I, N> const& indices, RandomIt table, fixed_vector<T, M>& out, std::size_t distance = 8);
+///
+/// \brief Assign values[k] to table[indices[k]] for each k; indices and values must be of equal size
+///
+template <typename I, std::size_t N, typename T, std::size_t M, typename RandomIt>
+void scatter(fixed_vector<I, N> const& indices, fixed_vector<T, M> const& values, RandomIt table);
+///
+/// \brief Invoke f(*ptr) for each pointer in ptrs, prefetching the pointee distance elements ahead
+///
+template <typename P, std::size_t N, typename F>
+void for_each_prefetched(fixed_vector<P, N> const& ptrs, F f, std::size_t distance = 8);
+
+// impl
+
+namespace detail {
+#if defined(KT_FIXED_VECTOR_AVX2)
+// compact_lanes[mask]: byte k is the source lane of the k-th set bit of mask
+constexpr std::array<std::uint64_t, 256> make_compact_lanes() noexcept {
+	std::array<std::uint64_t, 256> ret{};
+	for (std::size_t mask = 0; mask < 256; ++mask) {
+		std::size_t out = 0;
+		for (std::uint64_t lane = 0; lane < 8; ++lane) {
+			if (mask & (std::size_t{1} << lane)) { ret[mask] |= lane << (8 * out++); }
+		}
+	}
+	return ret;
+}
+inline constexpr std::array<std::uint64_t, 256> compact_lanes = make_compact_lanes();
+
+template <typename Compare, typename T>
+constexpr bool is_less_v = std::is_same_v<Compare, std::less<>> || std::is_same_v<Compare, std::less<T>>;
+template <typename Compare, typename T>
+constexpr bool is_greater_v = std::is_same_v<Compare, std::greater<>> || std::is_same_v<Compare, std::greater<T>>;
+template <typename T, typename Compare>
+constexpr bool has_compact_kernel_v =
+	(std::is_same_v<T, std::int32_t> || std::is_same_v<T, std::uint32_t> || std::is_same_v<T, float>) && (is_less_v<Compare, T> || is_greater_v<Compare, T>);
+
+// One bit per lane of v for which comp(lane, bound) holds
+template <typename T, typename Compare>
+std::uint32_t compare_mask(__m256i v, __m256i bound) noexcept {
+	__m256 cmp;
+	if constexpr (std::is_same_v<T, float>) {
+		__m256 const x = _mm256_castsi256_ps(v);
+		__m256 const b = _mm256_castsi256_ps(bound);
+		if constexpr (is_less_v<Compare, T>) {
+			cmp = _mm256_cmp_ps(x, b, _CMP_LT_OQ);
+		} else {
+			cmp = _mm256_cmp_ps(x, b, _CMP_GT_OQ);
+		}
+	} else {
+		if constexpr (std::is_same_v<T, std::uint32_t>) {
+			// flip the sign bits so that the signed compare orders unsigned values
+			__m256i const sign = _mm256_set1_epi32(INT32_MIN);
+			v = _mm256_xor_si256(v, sign);
+			bound = _mm256_xor_si256(bound, sign);
+		}
+		cmp = _mm256_castsi256_ps(is_less_v<Compare, T> ? _mm256_cmpgt_epi32(bound, v) : _mm256_cmpgt_epi32(v, bound));
+	}
+	return static_cast<std::uint32_t>(_mm256_movemask_ps(cmp));
+}
+
+// Compact whole 8-lane blocks of [src, src + count) while dst has room for a full 8-lane store
+// Returns the number of source elements consumed; the caller finishes the tail
+template <typename Compare, typename T, std::size_t N>
+std::size_t compact_avx2(T const* src, std::size_t count, fixed_vector<T, N>& dst, T const& bound) noexcept {
+	__m256i b;
+	if constexpr (std::is_same_v<T, float>) {
+		b = _mm256_castps_si256(_mm256_set1_ps(bound));
+	} else {
+		b = _mm256_set1_epi32(static_cast<int>(bound));
+	}
+	T* const out = fixed_vector_access::storage(dst);
+	std::size_t size = dst.size();
+	std::size_t i = 0;
+	for (; i + 8 <= count && N - size >= 8; i += 8) {
+		__m256i const v = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(src + i));
+		std::uint32_t const mask = compare_mask<T, Compare>(v, b);
+		__m256i const lanes = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<__m128i const*>(&compact_lanes[mask])));
+		// all 8 lanes are stored; only the first popcount(mask) become part of dst
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + size), _mm256_permutevar8x32_epi32(v, lanes));
+		size += static_cast<std::size_t>(popcount(mask));
+	}
+	fixed_vector_access::set_size(dst, size);
+	return i;
+}
+#endif
+} // namespace detail
+
+template <typename T, std::size_t N, typename BinaryPred>
+std::size_t unique(fixed_vector<T, N>& vec, BinaryPred pred) {
+	T* const first = vec.data();
+	T* const last = first + vec.size();
+	auto const ret = static_cast<std::size_t>(last - std::unique(first, last, pred));
+	vec.erase(vec.end() - static_cast<std::ptrdiff_t>(ret), vec.end());
+	return ret;
+}
+
+namespace detail {
+// First index in [first, size) whose element is not less than t: exponential probe, then binary search
+template <typename T, typename Compare>
+std::size_t gallop(T const* data, std::size_t first, std::size_t size, T const& t, Compare& comp) {
+	std::size_t step = 1;
+	std::size_t lo = first;
+	while (first + step < size && comp(data[first + step], t)) {
+		lo = first + step;
+		step *= 2;
+	}
+	std::size_t const hi = first + step < size ? first + step + 1 : size;
+	return static_cast<std::size_t>(std::lower_bound(data + lo, data + hi, t, comp) - data);
+}
+} // namespace detail
+
+template <typename T, std::size_t N, std::size_t M, std::size_t O, typename Compare>
+void merge_into(fixed_vector<T, N> const& lhs, fixed_vector<T, M> const& rhs, fixed_vector<T, O>& out, Compare comp) {
+	assert(out.size() + lhs.size() + rhs.size() <= out.capacity());
+	T const* l = lhs.data();
+	T const* r = rhs.data();
+	T const* const l_end = l + lhs.size();
+	T const* const r_end = r + rhs.size();
+	while (l != l_end && r != r_end) { out.push_back(comp(*r, *l) ? *r++ : *l++); }
+	for (; l != l_end; ++l) { out.push_back(*l); }
+	for (; r != r_end; ++r) { out.push_back(*r); }
+}
+template <typename T, std::size_t N, std::size_t M, std::size_t O, typename Compare>
+void set_union(fixed_vector<T, N> const& lhs, fixed_vector<T, M> const& rhs, fixed_vector<T, O>& out, Compare comp) {
+	T const* l = lhs.data();
+	T const* r = rhs.data();
+	T const* const l_end = l + lhs.size();
+	T const* const r_end = r + rhs.size();
+	while (l != l_end && r != r_end) {
+		if (comp(*l, *r)) {
+			out.push_back(*l++);
+		} else if (comp(*r, *l)) {
+			out.push_back(*r++);
+		} else {
+			out.push_back(*l++);
+			++r;
+		}
+	}
+	for (; l != l_end; ++l) { out.push_back(*l); }
+	for (; r != r_end; ++r) { out.push_back(*r); }
+}
+template <typename T, std::size_t N, std::size_t M, std::size_t O, typename Compare>
+void set_intersection(fixed_vector<T, N> const& lhs, fixed_vector<T, M> const& rhs, fixed_vector<T, O>& out, Compare comp) {
+	constexpr std::size_t gallop_ratio = 16;
+	T const* l = lhs.data();
+	T const* r = rhs.data();
+	std::size_t const l_size = lhs.size();
+	std::size_t const r_size = rhs.size();
+	if (l_size * gallop_ratio < r_size || r_size * gallop_ratio < l_size) {
+		bool const l_small = l_size < r_size;
+		T const* small = l_small ? l : r;
+		T const* large = l_small ? r : l;
+		std::size_t const small_size = l_small ? l_size : r_size;
+		std::size_t const large_size = l_small ? r_size : l_size;
+		std::size_t pos = 0;
+		for (std::size_t i = 0; i < small_size && pos < large_size; ++i) {
+			pos = detail::gallop(large, pos, large_size, small[i], comp);
+			if (pos < large_size && !comp(small[i], large[pos])) {
+				out.push_back(l_small ? small[i] : large[pos]);
+				++pos;
+			}
+		}
+		return;
+	}
+	T const* const l_end = l + l_size;
+	T const* const r_end = r + r_size;
+	while (l != l_end && r != r_end) {
+		if (comp(*l, *r)) {
+			++l;
+		} else if (comp(*r, *l)) {
+			++r;
+		} else {
+			out.push_back(*l++);
+			++r;
+		}
+	}
+}
+template <typename T, std::size_t N, std::size_t M, std::size_t O, typename Compare>
+void set_difference(fixed_vector<T, N> const& lhs, fixed_vector<T, M> const& rhs, fixed_vector<T, O>& out, Compare comp) {
+	T const* l = lhs.data();
+	T const* r = rhs.data();
+	T const* const l_end = l + lhs.size();
+	T const* const r_end = r + rhs.size();
+	while (l != l_end && r != r_end) {
+		if (comp(*l, *r)) {
+			out.push_back(*l++);
+		} else if (comp(*r, *l)) {
+			++r;
+		} else {
+			++l;
+			++r;
+		}
+	}
+	for (; l != l_end; ++l) { out.push_back(*l); }
+}
+
+template <typename InputIt, typename T, std::size_t N, typename Pred>
+std::size_t compact_into(InputIt first, InputIt last, fixed_vector<T, N>& dst, Pred pred) {
+	std::size_t const prev = dst.size();
+	for (; first != last && dst.has_space(); ++first) {
+		auto&& value = *first;
+		dst.push_back_if(pred(value), value);
+	}
+	// dst is full: any further match overflows and trips the push_back assert
+	for (; first != last; ++first) {
+		auto&& value = *first;
+		if (pred(value)) { dst.push_back(value); }
+	}
+	return dst.size() - prev;
+}
+template <typename T, std::size_t M, std::size_t N, typename Compare>
+std::size_t compact_into(fixed_vector<T, M> const& src, fixed_vector<T, N>& dst, Compare comp, typename fixed_vector<T, M>::value_type const& bound) {
+	T const* first = src.data();
+	T const* const last = first + src.size();
+	std::size_t const prev = dst.size();
+#if defined(KT_FIXED_VECTOR_AVX2)
+	if constexpr (detail::has_compact_kernel_v<T, Compare>) { first += detail::compact_avx2<Compare>(first, src.size(), dst, bound); }
+#endif
+	compact_into(first, last, dst, [&comp, &bound](T const& t) { return comp(t, bound); });
+	return dst.size() - prev;
+}
+template <std::size_t K, typename InputIt, typename KeyFn, typename T, std::size_t N>
+std::bitset<K> partition_into(InputIt first, InputIt last, KeyFn key_fn, fixed_vector<T, N> (&dst)[K]) {
+	std::bitset<K> ret;
+	if constexpr (std::is_trivial_v<T>) {
+		constexpr std::size_t lanes = sizeof(T) < 64 ? 64 / sizeof(T) : 1;
+		struct alignas(64) line_t {
+			T items[lanes];
+		};
+		auto flush = [&dst, &ret](std::size_t k, T const* items, std::size_t count) {
+			std::size_t const room = dst[k].capacity() - dst[k].size();
+			if (count > room) {
+				ret.set(k);
+				count = room;
+			}
+			dst[k].insert(dst[k].end(), items, items + count);
+		};
+		line_t lines[K];
+		std::uint8_t counts[K]{};
+		for (; first != last; ++first) {
+			T const t = *first;
+			auto const k = static_cast<std::size_t>(key_fn(t));
+			assert(k < K);
+			lines[k].items[counts[k]++] = t;
+			if (counts[k] == lanes) {
+				flush(k, lines[k].items, lanes);
+				counts[k] = 0;
+			}
+		}
+		for (std::size_t k = 0; k < K; ++k) { flush(k, lines[k].items, counts[k]); }
+	} else {
+		for (; first != last; ++first) {
+			auto&& value = *first;
+			auto const k = static_cast<std::size_t>(key_fn(value));
+			assert(k < K);
+			if (dst[k].has_space()) {
+				dst[k].push_back(value);
+			} else {
+				ret.set(k);
+			}
+		}
+	}
+	return ret;
+}
+
+template <typename I, std::size_t N, typename RandomIt, typename T, std::size_t M>
+void gather(fixed_vector<I, N> const& indices, RandomIt table, fixed_vector<T, M>& out, std::size_t distance) {
+	assert(out.size() + indices.size() <= out.capacity());
+	I const* index = indices.data();
+	std::size_t const size = indices.size();
+	std::size_t const warmup = distance < size ? distance : size;
+	for (std::size_t i = 0; i < warmup; ++i) { detail::prefetch(std::addressof(table[index[i]])); }
+	for (std::size_t i = 0; i < size; ++i) {
+		if (distance > 0 && i + distance < size) { detail::prefetch(std::addressof(table[index[i + distance]])); }
+		out.push_back(table[index[i]]);
+	}
+}
+template <typename I, std::size_t N, typename T, std::size_t M, typename RandomIt>
+void scatter(fixed_vector<I, N> const& indices, fixed_vector<T, M> const& values, RandomIt table) {
+	assert(indices.size() == values.size());
+	I const* index = indices.data();
+	T const* value = values.data();
+	for (std::size_t i = 0; i < indices.size(); ++i) { table[index[i]] = value[i]; }
+}
+template <typename P, std::size_t N, typename F>
+void for_each_prefetched(fixed_vector<P, N> const& ptrs, F f, std::size_t distance) {
+	static_assert(std::is_pointer_v<P>, "P must be a pointer type");
+	P const* data = ptrs.data();
+	std::size_t const size = ptrs.size();
+	std::size_t const warmup = distance < size ? distance : size;
+	for (std::size_t i = 0; i < warmup; ++i) { detail::prefetch(data[i]); }
+	for (std::size_t i = 0; i < size; ++i) {
+		if (i + distance < size) { detail::prefetch(data[i + distance]); }
+		f(*data[i]);
+	}
+}
+} // namespace kt
@@ -0,0 +1,152 @@
+// KT header-only library
+// Requirements: C++17
+
+#pragma once
+#include "fixed_vector.hpp"
+
+///
+/// \brief Opt-in element-wise arithmetic on fixed_vectors via lazy expression trees
+/// Bring the operators into scope with `using namespace kt::expr;` and evaluate with kt::expr::assign:
+/// the whole tree is computed in a single fused loop, with operand sizes checked once when nodes are built
+///
+namespace kt::expr {
+// Size of operands that broadcast (scalars)
+inline constexpr std::size_t any_size = static_cast<std::size_t>(-1);
+
+template <typename T>
+class terminal {
+  public:
+	terminal(T const* data, std::size_t size) noexcept : m_data(data), m_size(size) {}
+
+	T operator[](std::size_t index) const noexcept { return m_data[index]; }
+	std::size_t size() const noexcept { return m_size; }
+
+  private:
+	T const* m_data;
+	std::size_t m_size;
+};
+
+template <typename T>
+class scalar {
+  public:
+	explicit scalar(T value) noexcept : m_value(value) {}
+
+	T operator[](std::size_t) const noexcept { return m_value; }
+	std::size_t size() const noexcept { return any_size; }
+
+  private:
+	T m_value;
+};
+
+template <typename Op, typename E>
+class unary {
+  public:
+	explicit unary(E e) noexcept : m_e(e) {}
+
+	auto operator[](std::size_t index) const noexcept { return Op{}(m_e[index]); }
+	std::size_t size() const noexcept { return m_e.size(); }
+
+  private:
+	E m_e;
+};
+
+template <typename Op, typename L, typename R>
+class binary {
+  public:
+	binary(L lhs, R rhs) noexcept : m_lhs(lhs), m_rhs(rhs) { assert(lhs.size() == any_size || rhs.size() == any_size || lhs.size() == rhs.size()); }
+
+	auto operator[](std::size_t index) const noexcept { return Op{}(m_lhs[index], m_rhs[index]); }
+	std::size_t size() const noexcept { return m_lhs.size() == any_size ? m_rhs.size() : m_lhs.size(); }
+
+  private:
+	L m_lhs;
+	R m_rhs;
+};
+
+namespace detail {
+template <typename T>
+struct is_node : std::false_type {};
+template <typename T>
+struct is_node<terminal<T>> : std::true_type {};
+template <typename Op, typename E>
+struct is_node<unary<Op, E>> : std::true_type {};
+template <typename Op, typename L, typename R>
+struct is_node<binary<Op, L, R>> : std::true_type {};
+
+template <typename T>
+struct is_fixed_vector : std::false_type {};
+template <typename T, std::size_t N>
+struct is_fixed_vector<fixed_vector<T, N>> : std::true_type {};
+
+template <typename T>
+constexpr bool is_array_v = is_node<T>::value || is_fixed_vector<T>::value;
+template <typename T>
+constexpr bool is_operand_v = is_array_v<T> || std::is_arithmetic_v<T>;
+
+template <typename T, std::size_t N>
+terminal<T> wrap(fixed_vector<T, N> const& vec) noexcept {
+	return terminal<T>(vec.data(), vec.size());
+}
+template <typename T>
+auto wrap(T const& t) noexcept {
+	if constexpr (std::is_arithmetic_v<T>) {
+		return scalar<T>(t);
+	} else {
+		return t;
+	}
+}
+
+template <typename L, typename R>
+using enable_binary_t = std::enable_if_t<(is_array_v<L> || is_array_v<R>) && is_operand_v<L> && is_operand_v<R>>;
+
+template <typename Op, typename L, typename R>
+auto make_binary(L const& lhs, R const& rhs) noexcept {
+	auto l = wrap(lhs);
+	auto r = wrap(rhs);
+	return binary<Op, decltype(l), decltype(r)>(l, r);
+}
+} // namespace detail
+
+template <typename L, typename R, typename = detail::enable_binary_t<L, R>>
+auto operator+(L const& lhs, R const& rhs) noexcept {
+	return detail::make_binary<std::plus<>>(lhs, rhs);
+}
+template <typename L, typename R, typename = detail::enable_binary_t<L, R>>
+auto operator-(L const& lhs, R const& rhs) noexcept {
+	return detail::make_binary<std::minus<>>(lhs, rhs);
+}
+template <typename L, typename R, typename = detail::enable_binary_t<L, R>>
+auto operator*(L const& lhs, R const& rhs) noexcept {
+	return detail::make_binary<std::multiplies<>>(lhs, rhs);
+}
+template <typename L, typename R, typename = detail::enable_binary_t<L, R>>
+auto operator/(L const& lhs, R const& rhs) noexcept {
+	return detail::make_binary<std::divides<>>(lhs, rhs);
+}
+template <typename E, typename = std::enable_if_t<detail::is_array_v<E>>>
+auto operator-(E const& e) noexcept {
+	auto w = detail::wrap(e);
+	return unary<std::negate<>, decltype(w)>(w);
+}
+
+///
+/// \brief Evaluate e into dst in a single loop, resizing dst to the size of e
+///
+template <typename T, std::size_t N, typename E, typename = std::enable_if_t<detail::is_array_v<E>>>
+fixed_vector<T, N>& assign(fixed_vector<T, N>& dst, E const& e) {
+	auto const w = detail::wrap(e);
+	std::size_t const size = w.size();
+	assert(size <= N);
+	if constexpr (std::is_trivial_v<T>) {
+		// write straight into storage: resize() would value-initialize elements only to overwrite them
+		T* const out = kt::detail::fixed_vector_access::storage(dst);
+		for (std::size_t i = 0; i < size; ++i) { out[i] = static_cast<T>(w[i]); }
+		kt::detail::fixed_vector_access::set_size(dst, size);
+	} else {
+		dst.resize(size);
+		T* const out = dst.data();
+		for (std::size_t i = 0; i < size; ++i) { out[i] = static_cast<T>(w[i]); }
+	}
+	return dst;
+}
+} // namespace kt::expr
@@ -0,0 +1,181 @@
+// KT header-only library
+// Requirements: C++17
+
+#pragma once
+#include "fixed_vector.hpp"
+
+///
+/// \brief Opt-in numeric reductions and scans over arithmetic fixed_vectors
+///
+namespace kt {
+// T must be arithmetic
+// reduce, dot, min_max, argmin and argmax accumulate in independent lanes that are combined at the end;
+// floating-point results may therefore differ from a sequential loop in the last bits, and are unspecified with NaNs
+// Scans are evaluated strictly left to right
+
+///
+/// \brief Sum of all elements plus init
+///
+template <typename T, std::size_t N>
+T reduce(fixed_vector<T, N> const& vec, T init = T{}) noexcept;
+///
+/// \brief Sum of the element-wise products of lhs and rhs, which must be of equal size
+///
+template <typename T, std::size_t N, std::size_t M>
+T dot(fixed_vector<T, N> const& lhs, fixed_vector<T, M> const& rhs) noexcept;
+///
+/// \brief Smallest and largest elements of a non-empty vector
+///
+template <typename T, std::size_t N>
+std::pair<T, T> min_max(fixed_vector<T, N> const& vec) noexcept;
+///
+/// \brief Index of the first smallest element of a non-empty vector
+///
+template <typename T, std::size_t N>
+std::size_t argmin(fixed_vector<T, N> const& vec) noexcept;
+///
+/// \brief Index of the first largest element of a non-empty vector
+///
+template <typename T, std::size_t N>
+std::size_t argmax(fixed_vector<T, N> const& vec) noexcept;
+///
+/// \brief Replace each element with the sum of itself and all preceding elements
+///
+template <typename T, std::size_t N>
+void inclusive_scan(fixed_vector<T, N>& vec) noexcept;
+///
+/// \brief Replace each element with init plus the sum of all preceding elements
+///
+template <typename T, std::size_t N>
+void exclusive_scan(fixed_vector<T, N>& vec, T init = T{}) noexcept;
+
+// impl
+
+namespace detail {
+// Independent accumulators per reduction: a power of two, unrolled from the capacity
+template <std::size_t N>
+constexpr std::size_t reduce_lanes_v = N >= 8 ? 8 : (N >= 4 ? 4 : (N >= 2 ? 2 : 1));
+
+template <std::size_t Lanes, typename T, typename Op>
+T fold_lanes(T (&acc)[Lanes], Op op) noexcept {
+	for (std::size_t width = Lanes / 2; width > 0; width /= 2) {
+		for (std::size_t l = 0; l < width; ++l) { acc[l] = op(acc[l], acc[l + width]); }
+	}
+	return acc[0];
+}
+
+template <bool Max, typename T>
+std::size_t arg_extreme(T const* data, std::size_t size) noexcept {
+	constexpr std::size_t lanes = 4;
+	auto const better = [](T a, T b) { return Max ? b < a : a < b; };
+	assert(size > 0);
+	if (size < lanes) {
+		std::size_t ret = 0;
+		for (std::size_t i = 1; i < size; ++i) { ret = better(data[i], data[ret]) ? i : ret; }
+		return ret;
+	}
+	T best[lanes];
+	std::size_t index[lanes];
+	for (std::size_t l = 0; l < lanes; ++l) {
+		best[l] = data[l];
+		index[l] = l;
+	}
+	std::size_t i = lanes;
+	for (; i + lanes <= size; i += lanes) {
+		for (std::size_t l = 0; l < lanes; ++l) {
+			bool const b = better(data[i + l], best[l]);
+			best[l] = b ? data[i + l] : best[l];
+			index[l] = b ? i + l : index[l];
+		}
+	}
+	std::size_t ret = index[0];
+	for (std::size_t l = 1; l < lanes; ++l) {
+		if (better(best[l], data[ret]) || (!better(data[ret], best[l]) && index[l] < ret)) { ret = index[l]; }
+	}
+	for (; i < size; ++i) { ret = better(data[i], data[ret]) ? i : ret; }
+	return ret;
+}
+} // namespace detail
+
+template <typename T, std::size_t N>
+T reduce(fixed_vector<T, N> const& vec, T init) noexcept {
+	static_assert(std::is_arithmetic_v<T>, "T must be arithmetic");
+	constexpr std::size_t lanes = detail::reduce_lanes_v<N>;
+	T const* data = vec.data();
+	std::size_t const size = vec.size();
+	T acc[lanes]{};
+	std::size_t i = 0;
+	for (; i + lanes <= size; i += lanes) {
+		for (std::size_t l = 0; l < lanes; ++l) { acc[l] += data[i + l]; }
+	}
+	for (; i < size; ++i) { acc[i % lanes] += data[i]; }
+	return init + detail::fold_lanes(acc, std::plus<T>{});
+}
+template <typename T, std::size_t N, std::size_t M>
+T dot(fixed_vector<T, N> const& lhs, fixed_vector<T, M> const& rhs) noexcept {
+	static_assert(std::is_arithmetic_v<T>, "T must be arithmetic");
+	assert(lhs.size() == rhs.size());
+	constexpr std::size_t lanes = detail::reduce_lanes_v<(N < M ? N : M)>;
+	T const* l_data = lhs.data();
+	T const* r_data = rhs.data();
+	std::size_t const size = lhs.size();
+	T acc[lanes]{};
+	std::size_t i = 0;
+	for (; i + lanes <= size; i += lanes) {
+		for (std::size_t l = 0; l < lanes; ++l) { acc[l] += l_data[i + l] * r_data[i + l]; }
+	}
+	for (; i < size; ++i) { acc[i % lanes] += l_data[i] * r_data[i]; }
+	return detail::fold_lanes(acc, std::plus<T>{});
+}
+template <typename T, std::size_t N>
+std::pair<T, T> min_max(fixed_vector<T, N> const& vec) noexcept {
+	static_assert(std::is_arithmetic_v<T>, "T must be arithmetic");
+	assert(!vec.empty());
+	constexpr std::size_t lanes = detail::reduce_lanes_v<N>;
+	auto const min = [](T a, T b) { return b < a ? b : a; };
+	auto const max = [](T a, T b) { return a < b ? b : a; };
+	T const* data = vec.data();
+	std::size_t const size = vec.size();
+	T lo[lanes];
+	T hi[lanes];
+	for (std::size_t l = 0; l < lanes; ++l) { lo[l] = hi[l] = data[0]; }
+	std::size_t i = 0;
+	for (; i + lanes <= size; i += lanes) {
+		for (std::size_t l = 0; l < lanes; ++l) {
+			lo[l] = min(lo[l], data[i + l]);
+			hi[l] = max(hi[l], data[i + l]);
+		}
+	}
+	for (; i < size; ++i) {
+		lo[0] = min(lo[0], data[i]);
+		hi[0] = max(hi[0], data[i]);
+	}
+	return {detail::fold_lanes(lo, min), detail::fold_lanes(hi, max)};
+}
+template <typename T, std::size_t N>
+std::size_t argmin(fixed_vector<T, N> const& vec) noexcept {
+	static_assert(std::is_arithmetic_v<T>, "T must be arithmetic");
+	return detail::arg_extreme<false>(vec.data(), vec.size());
+}
+template <typename T, std::size_t N>
+std::size_t argmax(fixed_vector<T, N> const& vec) noexcept {
+	static_assert(std::is_arithmetic_v<T>, "T must be arithmetic");
+	return detail::arg_extreme<true>(vec.data(), vec.size());
+}
+template <typename T, std::size_t N>
+void inclusive_scan(fixed_vector<T, N>& vec) noexcept {
+	static_assert(std::is_arithmetic_v<T>, "T must be arithmetic");
+	T* data = vec.data();
+	for (std::size_t i = 1; i < vec.size(); ++i) { data[i] += data[i - 1]; }
+}
+template <typename T, std::size_t N>
+void exclusive_scan(fixed_vector<T, N>& vec, T init) noexcept {
+	static_assert(std::is_arithmetic_v<T>, "T must be arithmetic");
+	T* data = vec.data();
+	for (std::size_t i = 0; i < vec.size(); ++i) {
+		T const t = data[i];
+		data[i] = init;
+		init += t;
+	}
+}
+} // namespace kt
@@ -0,0 +1,271 @@
+// KT header-only library
+// Requirements: C++17
+
+#pragma once
+#include "fixed_vector.hpp"
+
+namespace kt {
+namespace detail {
+// Capacities up to which a branchless linear count beats binary search
+inline constexpr std::size_t linear_search_max_v = 64;
+
+// Number of leading elements of [data, data + size) satisfying pred (which must partition the range)
+template <typename T, typename Pred>
+std::size_t linear_partition_point(T const* data, std::size_t size, Pred pred) noexcept {
+	std::size_t ret = 0;
+	for (std::size_t i = 0; i < size; ++i) { ret += static_cast<std::size_t>(pred(data[i])); }
+	return ret;
+}
+template <typename T, typename Pred>
+std::size_t branchless_partition_point(T const* data, std::size_t size, Pred pred) noexcept {
+	if (size == 0) { return 0; }
+	T const* base = data;
+	while (size > 1) {
+		std::size_t const half = size / 2;
+		base = pred(base[half]) ? base + half : base;
+		size -= half;
+	}
+	return static_cast<std::size_t>(base - data) + static_cast<std::size_t>(pred(*base));
+}
+// Search strategy chosen from the capacity N
+template <std::size_t N, typename T, typename Pred>
+std::size_t sorted_partition_point(T const* data, std::size_t size, Pred pred) noexcept {
+	if constexpr (N <= linear_search_max_v) {
+		return linear_partition_point(data, size, pred);
+	} else {
+		return branchless_partition_point(data, size, pred);
+	}
+}
+} // namespace detail
+
+///
+/// \brief fixed_vector that keeps its elements sorted by Compare (duplicates allowed)
+/// Lookups count linearly for small N and use a branchless binary search otherwise
+///
+template <typename T, std::size_t N, typename Compare = std::less<>>
+class sorted_fixed_vector {
+  public:
+	using size_type = std::size_t;
+	using value_type = T;
+	using const_iterator = T const*;
+	using iterator = const_iterator;
+
+	static constexpr size_type max_size() noexcept { return N; }
+
+	sorted_fixed_vector() = default;
+	explicit sorted_fixed_vector(Compare comp) : m_comp(std::move(comp)) {}
+	sorted_fixed_vector(std::initializer_list<T> init, Compare comp = {});
+	template <typename InputIt, typename = std::enable_if_t<!std::is_same_v<typename std::iterator_traits<InputIt>::iterator_category, void>>>
+	sorted_fixed_vector(InputIt first, InputIt last, Compare comp = {});
+
+	T const& operator[](size_type index) const noexcept { return m_data[index]; }
+	T const& front() const noexcept { return m_data.front(); }
+	T const& back() const noexcept { return m_data.back(); }
+	T const* data() const noexcept { return m_data.data(); }
+	fixed_vector<T, N> const& vector() const noexcept { return m_data; }
+
+	const_iterator begin() const noexcept { return data(); }
+	const_iterator end() const noexcept { return data() + size(); }
+	const_iterator cbegin() const noexcept { return begin(); }
+	const_iterator cend() const noexcept { return end(); }
+
+	bool empty() const noexcept { return m_data.empty(); }
+	size_type size() const noexcept { return m_data.size(); }
+	constexpr size_type capacity() const noexcept { return N; }
+	bool has_space() const noexcept { return m_data.has_space(); }
+
+	template <typename U>
+	const_iterator lower_bound(U const& t) const noexcept;
+	template <typename U>
+	const_iterator upper_bound(U const& t) const noexcept;
+	template <typename U>
+	const_iterator find(U const& t) const noexcept;
+	template <typename U>
+	bool contains(U const& t) const noexcept {
+		return find(t) != end();
+	}
+	template <typename U>
+	size_type count(U const& t) const noexcept {
+		return static_cast<size_type>(upper_bound(t) - lower_bound(t));
+	}
+
+	void clear() noexcept { m_data.clear(); }
+	///
+	/// \brief Insert t after any equivalent elements
+	///
+	const_iterator insert(T const& t) { return emplace(t); }
+	const_iterator insert(T&& t) { return emplace(std::move(t)); }
+	template <typename... Args>
+	const_iterator emplace(Args&&... args);
+	const_iterator erase(const_iterator pos);
+	const_iterator erase(const_iterator first, const_iterator last);
+	///
+	/// \brief Erase all elements equivalent to t
+	/// \returns Number of elements erased
+	///
+	template <typename U>
+	size_type erase_key(U const& t);
+
+  private:
+	size_type index(const_iterator it) const noexcept { return static_cast<size_type>(it - begin()); }
+	typename fixed_vector<T, N>::const_iterator vec_iter(const_iterator it) const noexcept {
+		return m_data.cbegin() + static_cast<std::ptrdiff_t>(index(it));
+	}
+
+	fixed_vector<T, N> m_data;
+	Compare m_comp;
+};
+
+///
+/// \brief Read-only sorted set of elements stored in Eytzinger (BFS) order
+/// Each lookup descends an implicit binary tree whose top levels share cache lines,
+/// prefetching the block of descendants a few levels ahead; T must be default constructible and copy assignable
+/// The tree is stored 1-based (slot 0 unused) in 64-byte aligned storage, so when sizeof(T) divides 64
+/// the descendants of a node log2(64 / sizeof(T)) levels down fill exactly one cache line
+///
+template <typename T, std::size_t N, typename Compare = std::less<>>
+class eytzinger_fixed_vector {
+  public:
+	using size_type = std::size_t;
+	using value_type = T;
+	using const_iterator = T const*;
+
+	eytzinger_fixed_vector() = default;
+	///
+	/// \brief Build from a range sorted by comp; single-pass input ranges are staged into a temporary first
+	///
+	template <typename InputIt, typename = std::enable_if_t<!std::is_same_v<typename std::iterator_traits<InputIt>::iterator_category, void>>>
+	eytzinger_fixed_vector(InputIt first, InputIt last, Compare comp = {});
+	template <std::size_t M>
+	explicit eytzinger_fixed_vector(sorted_fixed_vector<T, M, Compare> const& sorted) : eytzinger_fixed_vector(sorted.begin(), sorted.end()) {}
+
+	bool empty() const noexcept { return size() == 0; }
+	size_type size() const noexcept { return m_data.empty() ? 0 : m_data.size() - 1; }
+	constexpr size_type capacity() const noexcept { return N; }
+
+	///
+	/// \brief Storage in layout (not sorted) order
+	///
+	const_iterator begin() const noexcept { return empty() ? nullptr : m_data.data() + 1; }
+	const_iterator end() const noexcept { return begin() + size(); }
+
+	///
+	/// \brief First element not less than t, or nullptr
+	///
+	template <typename U>
+	T const* lower_bound(U const& t) const noexcept;
+	template <typename U>
+	bool contains(U const& t) const noexcept {
+		T const* ret = lower_bound(t);
+		return ret && !m_comp(t, *ret);
+	}
+
+  private:
+	template <typename InputIt>
+	void build(InputIt& it, size_type k);
+
+	alignas(64) fixed_vector<T, N + 1> m_data;
+	Compare m_comp;
+};
+
+// impl
+
+template <typename T, std::size_t N, typename Compare>
+sorted_fixed_vector<T, N, Compare>::sorted_fixed_vector(std::initializer_list<T> init, Compare comp) : sorted_fixed_vector(init.begin(), init.end(), std::move(comp)) {}
+template <typename T, std::size_t N, typename Compare>
+template <typename InputIt, typename>
+sorted_fixed_vector<T, N, Compare>::sorted_fixed_vector(InputIt first, InputIt last, Compare comp) : m_data(first, last), m_comp(std::move(comp)) {
+	if (!m_data.empty()) { std::stable_sort(m_data.data(), m_data.data() + m_data.size(), m_comp); }
+}
+template <typename T, std::size_t N, typename Compare>
+template <typename U>
+typename sorted_fixed_vector<T, N, Compare>::const_iterator sorted_fixed_vector<T, N, Compare>::lower_bound(U const& t) const noexcept {
+	return begin() + detail::sorted_partition_point<N>(data(), size(), [&](T const& e) { return m_comp(e, t); });
+}
+template <typename T, std::size_t N, typename Compare>
+template <typename U>
+typename sorted_fixed_vector<T, N, Compare>::const_iterator sorted_fixed_vector<T, N, Compare>::upper_bound(U const& t) const noexcept {
+	return begin() + detail::sorted_partition_point<N>(data(), size(), [&](T const& e) { return !m_comp(t, e); });
+}
+template <typename T, std::size_t N, typename Compare>
+template <typename U>
+typename sorted_fixed_vector<T, N, Compare>::const_iterator sorted_fixed_vector<T, N, Compare>::find(U const& t) const noexcept {
+	const_iterator const ret = lower_bound(t);
+	return ret != end() && !m_comp(t, *ret) ? ret : end();
+}
+template <typename T, std::size_t N, typename Compare>
+template <typename... Args>
+typename sorted_fixed_vector<T, N, Compare>::const_iterator sorted_fixed_vector<T, N, Compare>::emplace(Args&&... args) {
+	assert(has_space());
+	T t(std::forward<Args>(args)...);
+	size_type const idx = index(upper_bound(t));
+	m_data.insert(m_data.cbegin() + static_cast<std::ptrdiff_t>(idx), std::move(t));
+	return begin() + idx;
+}
+template <typename T, std::size_t N, typename Compare>
+typename sorted_fixed_vector<T, N, Compare>::const_iterator sorted_fixed_vector<T, N, Compare>::erase(const_iterator pos) {
+	size_type const idx = index(pos);
+	m_data.erase(vec_iter(pos));
+	return begin() + idx;
+}
+template <typename T, std::size_t N, typename Compare>
+typename sorted_fixed_vector<T, N, Compare>::const_iterator sorted_fixed_vector<T, N, Compare>::erase(const_iterator first, const_iterator last) {
+	size_type const idx = index(first);
+	m_data.erase(vec_iter(first), vec_iter(last));
+	return begin() + idx;
+}
+template <typename T, std::size_t N, typename Compare>
+template <typename U>
+typename sorted_fixed_vector<T, N, Compare>::size_type sorted_fixed_vector<T, N, Compare>::erase_key(U const& t) {
+	const_iterator const first = lower_bound(t);
+	const_iterator const last = upper_bound(t);
+	auto const ret = static_cast<size_type>(last - first);
+	if (ret > 0) { erase(first, last); }
+	return ret;
+}
+
+template <typename T, std::size_t N, typename Compare>
+template <typename InputIt, typename>
+eytzinger_fixed_vector<T, N, Compare>::eytzinger_fixed_vector(InputIt first, InputIt last, Compare comp) : m_comp(std::move(comp)) {
+	if constexpr (std::is_base_of_v<std::forward_iterator_tag, typename std::iterator_traits<InputIt>::iterator_category>) {
+		auto const count = static_cast<size_type>(std::distance(first, last));
+		assert(count <= N);
+		if (count == 0) { return; }
+		m_data.resize(count + 1);
+		build(first, 1);
+	} else {
+		// single pass: stage the input, then build from the staged copy
+		fixed_vector<T, N> staged(first, last);
+		if (staged.empty()) { return; }
+		m_data.resize(staged.size() + 1);
+		T const* it = staged.data();
+		build(it, 1);
+	}
+}
+template <typename T, std::size_t N, typename Compare>
+template <typename InputIt>
+void eytzinger_fixed_vector<T, N, Compare>::build(InputIt& it, size_type k) {
+	// in-order traversal of the implicit tree assigns sorted input to BFS slots (1-based k)
+	if (k > size()) { return; }
+	build(it, 2 * k);
+	m_data[k] = *it;
+	++it;
+	build(it, 2 * k + 1);
+}
+template <typename T, std::size_t N, typename Compare>
+template <typename U>
+T const* eytzinger_fixed_vector<T, N, Compare>::lower_bound(U const& t) const noexcept {
+	// descendants log2(block) levels below k occupy [k * block, k * block + block): one aligned cache line
+	constexpr size_type block = sizeof(T) < 64 ? 64 / sizeof(T) : 1;
+	T const* data = m_data.data();
+	size_type const count = size();
+	size_type k = 1;
+	while (k <= count) {
+		if (k * block <= count) { detail::prefetch(data + k * block); }
+		k = 2 * k + static_cast<size_type>(m_comp(data[k], t));
+	}
+	// k encodes the path taken; strip the trailing right turns and the final left turn
+	k >>= detail::countr_zero(~static_cast<std::uint64_t>(k)) + 1;
+	return k == 0 ? nullptr : data + k;
+}
+} // namespace kt